@@ -150,6 +150,9 @@ static const char HELP_STRING[] =
 #ifdef ENABLE_GRIM
 	"  --dimuse-tempo=NUM       Set internal Digital iMuse tempo (10 - 100) per second\n"
 	"                           (default: 10)\n"
+	"  --benchmark=FILE         Run without frame limit using the software renderer,\n"
+	"                           and write per frame CPU times to FILE (.csv or .json).\n"
+	"                           Recordings are played back as fast as possible\n"
 #endif
 	"  --engine-speed=NUM       Set frame per second limit (0 - 100), 0 = no limit\n"
 	"                           (default: 60)\n"
@@ -681,6 +684,9 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 #ifdef ENABLE_GRIM
 			DO_LONG_OPTION_INT("dimuse-tempo")
 			END_OPTION
+
+			DO_LONG_OPTION("benchmark")
+			END_OPTION
 #endif
 
 
@@ -222,8 +222,6 @@ void Actor::saveState(SaveGame *savedState) const {
 			savedState->writeString(p.sector->getName());
 		}
 
-		savedState->writeLESint32(shadow.shadowMaskSize);
-		savedState->write(shadow.shadowMask, shadow.shadowMaskSize);
 		savedState->writeBool(shadow.active);
 		savedState->writeBool(shadow.dontNegate);
 	}
@@ -406,13 +404,18 @@ bool Actor::restoreState(SaveGame *savedState) {
 			}
 		}
 
-		shadow.shadowMaskSize = savedState->readLESint32();
+		// The shadow mask is scratch memory reallocated by the renderers,
+		// older savegames stored its contents
 		delete[] shadow.shadowMask;
-		if (shadow.shadowMaskSize > 0) {
-			shadow.shadowMask = new byte[shadow.shadowMaskSize];
-			savedState->read(shadow.shadowMask, shadow.shadowMaskSize);
-		} else {
-			shadow.shadowMask = nullptr;
+		shadow.shadowMask = nullptr;
+		shadow.shadowMaskSize = 0;
+		if (savedState->saveMinorVersion() < 28) {
+			int32 shadowMaskSize = savedState->readLESint32();
+			if (shadowMaskSize > 0) {
+				byte *shadowMask = new byte[shadowMaskSize];
+				savedState->read(shadowMask, shadowMaskSize);
+				delete[] shadowMask;
+			}
 		}
 		shadow.active = savedState->readBool();
 		shadow.dontNegate = savedState->readBool();
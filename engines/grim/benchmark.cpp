@@ -0,0 +1,189 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#include "common/system.h"
+#include "common/textconsole.h"
+
+#include "engines/grim/benchmark.h"
+
+namespace Grim {
+
+const char *const Benchmark::_phaseNames[kPhaseCount] = {
+	"lua",
+	"actors",
+	"draw",
+	"rasterize"
+};
+
+const char *const Benchmark::_counterNames[kCounterCount] = {
+	"nodes_recomputed",
+	"nodes_cached"
+};
+
+Benchmark::Benchmark(const Common::String &fileName) :
+		_frame(0), _frameStart(0), _rowFrames(0), _rowTime(0),
+		_totalTime(0), _minFrameTime(0xFFFFFFFF), _maxFrameTime(0) {
+	for (int i = 0; i < kPhaseCount; i++) {
+		_phaseStart[i] = 0;
+		_phaseTime[i] = 0;
+		_rowPhaseTime[i] = 0;
+		_totalPhaseTime[i] = 0;
+	}
+	for (int i = 0; i < kCounterCount; i++) {
+		_counters[i] = 0;
+		_rowCounters[i] = 0;
+	}
+
+	_json = fileName.hasSuffixIgnoreCase(".json");
+	if (!_file.open(fileName, true)) {
+		warning("Benchmark: Unable to open '%s' for writing", fileName.c_str());
+		return;
+	}
+
+	// Rows are written as they come, so that the data is still usable
+	// if the run is interrupted, for instance at the end of a recording playback
+	if (_json) {
+		_file.writeString("{ \"frames\": [\n");
+	} else {
+		_file.writeString("frame,frames,total");
+		for (int i = 0; i < kPhaseCount; i++) {
+			_file.writeString(Common::String::format(",%s", _phaseNames[i]));
+		}
+		for (int i = 0; i < kCounterCount; i++) {
+			_file.writeString(Common::String::format(",%s", _counterNames[i]));
+		}
+		_file.writeString("\n");
+	}
+}
+
+Benchmark::~Benchmark() {
+	if (_frame == 0)
+		return;
+
+	if (_rowFrames > 0) {
+		writeRow();
+	}
+
+	Common::String summary = Common::String::format("Benchmark: %u frames, %.2f ms per frame (min %u, max %u)",
+	                                                _frame, (double)_totalTime / _frame, _minFrameTime, _maxFrameTime);
+	for (int i = 0; i < kPhaseCount; i++) {
+		summary += Common::String::format(", %s %.2f ms", _phaseNames[i], (double)_totalPhaseTime[i] / _frame);
+	}
+	g_system->logMessage(LogMessageType::kInfo, (summary + "\n").c_str());
+
+	if (!_file.isOpen())
+		return;
+
+	if (_json) {
+		_file.writeString(Common::String::format("\n], \"summary\": { \"frames\": %u, \"total\": %u, \"min\": %u, \"max\": %u",
+		                                         _frame, _totalTime, _minFrameTime, _maxFrameTime));
+		for (int i = 0; i < kPhaseCount; i++) {
+			_file.writeString(Common::String::format(", \"%s\": %u", _phaseNames[i], _totalPhaseTime[i]));
+		}
+		_file.writeString(" } }\n");
+	}
+	_file.finalize();
+	_file.close();
+}
+
+void Benchmark::beginFrame() {
+	_frameStart = g_system->getMillis(true);
+	for (int i = 0; i < kPhaseCount; i++) {
+		_phaseTime[i] = 0;
+	}
+	for (int i = 0; i < kCounterCount; i++) {
+		_counters[i] = 0;
+	}
+}
+
+void Benchmark::endFrame() {
+	uint32 frameTime = g_system->getMillis(true) - _frameStart;
+
+	_totalTime += frameTime;
+	_minFrameTime = MIN(_minFrameTime, frameTime);
+	_maxFrameTime = MAX(_maxFrameTime, frameTime);
+
+	_rowTime += frameTime;
+	for (int i = 0; i < kPhaseCount; i++) {
+		_totalPhaseTime[i] += _phaseTime[i];
+		_rowPhaseTime[i] += _phaseTime[i];
+	}
+	for (int i = 0; i < kCounterCount; i++) {
+		_rowCounters[i] += _counters[i];
+	}
+
+	_frame++;
+	_rowFrames++;
+	if (_rowFrames == kFramesPerRow) {
+		writeRow();
+	}
+}
+
+void Benchmark::writeRow() {
+	uint32 firstFrame = _frame - _rowFrames;
+	double frames = _rowFrames;
+
+	if (_file.isOpen()) {
+		Common::String row;
+		if (_json) {
+			row = Common::String::format("%s{ \"frame\": %u, \"frames\": %u, \"total\": %.2f",
+			                             firstFrame ? ",\n" : "", firstFrame, _rowFrames, _rowTime / frames);
+			for (int i = 0; i < kPhaseCount; i++) {
+				row += Common::String::format(", \"%s\": %.2f", _phaseNames[i], _rowPhaseTime[i] / frames);
+			}
+			for (int i = 0; i < kCounterCount; i++) {
+				row += Common::String::format(", \"%s\": %.1f", _counterNames[i], _rowCounters[i] / frames);
+			}
+			row += " }";
+		} else {
+			row = Common::String::format("%u,%u,%.2f", firstFrame, _rowFrames, _rowTime / frames);
+			for (int i = 0; i < kPhaseCount; i++) {
+				row += Common::String::format(",%.2f", _rowPhaseTime[i] / frames);
+			}
+			for (int i = 0; i < kCounterCount; i++) {
+				row += Common::String::format(",%.1f", _rowCounters[i] / frames);
+			}
+			row += "\n";
+		}
+		_file.writeString(row);
+	}
+
+	_rowFrames = 0;
+	_rowTime = 0;
+	for (int i = 0; i < kPhaseCount; i++) {
+		_rowPhaseTime[i] = 0;
+	}
+	for (int i = 0; i < kCounterCount; i++) {
+		_rowCounters[i] = 0;
+	}
+}
+
+void Benchmark::beginPhase(Phase phase) {
+	_phaseStart[phase] = g_system->getMillis(true);
+}
+
+void Benchmark::endPhase(Phase phase) {
+	_phaseTime[phase] += g_system->getMillis(true) - _phaseStart[phase];
+}
+
+} // end of namespace Grim
@@ -0,0 +1,100 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#ifndef GRIM_BENCHMARK_H
+#define GRIM_BENCHMARK_H
+
+#include "common/file.h"
+#include "common/str.h"
+
+namespace Grim {
+
+/**
+ * Records the CPU time spent in each frame of the main loop, broken down
+ * in phases, along with a few per frame counters, and writes them to a CSV
+ * or JSON file (depending on the file extension). Enabled with the --benchmark command line option.
+ *
+ * Times are measured with OSystem::getMillis(), bypassing the event
+ * recorder, which only has a millisecond resolution. Each row of the file
+ * covers a fixed number of frames and holds per frame averages, so that
+ * the rounding of the individual measurements averages out.
+ */
+class Benchmark {
+public:
+	enum Phase {
+		kPhaseLua,         // Lua scripts
+		kPhaseActors,      // Actor, iris and text object updates
+		kPhaseDraw,        // Renderer calls recording the frame
+		kPhaseRasterize,   // Presenting the frame, TinyGL rasterizes its draw calls here
+		kPhaseCount
+	};
+
+	enum Counter {
+		kCounterNodesRecomputed,   // Model nodes whose transforms were rebuilt
+		kCounterNodesCached,       // Model nodes whose cached transforms were reused
+		kCounterCount
+	};
+
+	Benchmark(const Common::String &fileName);
+	~Benchmark();
+
+	void beginFrame();
+	void endFrame();
+
+	void beginPhase(Phase phase);
+	void endPhase(Phase phase);
+
+	void addToCounter(Counter counter, uint32 value = 1) { _counters[counter] += value; }
+
+private:
+	static const uint32 kFramesPerRow = 30;
+
+	static const char *const _phaseNames[kPhaseCount];
+	static const char *const _counterNames[kCounterCount];
+
+	void writeRow();
+
+	Common::DumpFile _file;
+	bool _json;
+
+	uint32 _frame;
+	uint32 _frameStart;
+	uint32 _phaseStart[kPhaseCount];
+	uint32 _phaseTime[kPhaseCount];
+	uint32 _counters[kCounterCount];
+
+	// Sums over the frames of the row being accumulated
+	uint32 _rowFrames;
+	uint32 _rowTime;
+	uint32 _rowPhaseTime[kPhaseCount];
+	uint32 _rowCounters[kCounterCount];
+
+	uint32 _totalTime;
+	uint32 _totalPhaseTime[kPhaseCount];
+	uint32 _minFrameTime;
+	uint32 _maxFrameTime;
+};
+
+} // end of namespace Grim
+
+#endif
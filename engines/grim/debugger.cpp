@@ -27,8 +27,23 @@
 #include "engines/grim/md5check.h"
 #include "engines/grim/grim.h"
 
+#include "engines/grim/lua/lopstats.h"
+
 namespace Grim {
 
+struct OpcodeCountComparator {
+	bool operator()(int a, int b) const {
+		return luaV_opcodeStats.counts[a] > luaV_opcodeStats.counts[b];
+	}
+};
+
+struct OpcodePairCountComparator {
+	bool operator()(int a, int b) const {
+		return luaV_opcodeStats.pairCounts[a / NUM_OPCODES][a % NUM_OPCODES] >
+		       luaV_opcodeStats.pairCounts[b / NUM_OPCODES][b % NUM_OPCODES];
+	}
+};
+
 Debugger::Debugger() :
 		GUI::Debugger() {
 
@@ -38,6 +53,7 @@ Debugger::Debugger() :
 	registerCmd("set_renderer", WRAP_METHOD(Debugger, cmd_set_renderer));
 	registerCmd("save", WRAP_METHOD(Debugger, cmd_save));
 	registerCmd("load", WRAP_METHOD(Debugger, cmd_load));
+	registerCmd("lua_opcodes", WRAP_METHOD(Debugger, cmd_lua_opcodes));
 }
 
 Debugger::~Debugger() {
@@ -127,4 +143,60 @@ bool Debugger::cmd_load(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmd_lua_opcodes(int argc, const char **argv) {
+	if (argc < 2) {
+		debugPrintf("Usage: lua_opcodes <on|off|show> [count]\n");
+		debugPrintf("Counts the executed Lua opcodes and opcode pairs\n");
+		return true;
+	}
+
+	Common::String action = argv[1];
+	if (action == "on") {
+		luaV_resetOpcodeStats();
+		luaV_opcodeStats.enabled = true;
+		debugPrintf("Lua opcode counting enabled\n");
+	} else if (action == "off") {
+		luaV_opcodeStats.enabled = false;
+		debugPrintf("Lua opcode counting disabled\n");
+	} else if (action == "show") {
+		int count = argc > 2 ? atoi(argv[2]) : 20;
+
+		uint64 total = 0;
+		Common::Array<int> opcodes;
+		for (int i = 0; i < NUM_FUSED_OPCODES; i++) {
+			total += luaV_opcodeStats.counts[i];
+			if (luaV_opcodeStats.counts[i])
+				opcodes.push_back(i);
+		}
+		Common::sort(opcodes.begin(), opcodes.end(), OpcodeCountComparator());
+
+		debugPrintf("%llu opcodes executed\n", (unsigned long long)total);
+		for (uint i = 0; i < opcodes.size() && (int)i < count; i++) {
+			uint32 n = luaV_opcodeStats.counts[opcodes[i]];
+			debugPrintf("%8u %5.1f%% %s\n", n, 100.0 * n / total, luaV_opcodeName(opcodes[i]));
+		}
+
+		// Superinstruction candidates: pairs of regular opcodes executed one after the other.
+		// The superinstructions are counted as the two opcodes they replace.
+		Common::Array<int> pairs;
+		for (int i = 0; i < NUM_OPCODES * NUM_OPCODES; i++) {
+			if (luaV_opcodeStats.pairCounts[i / NUM_OPCODES][i % NUM_OPCODES])
+				pairs.push_back(i);
+		}
+		Common::sort(pairs.begin(), pairs.end(), OpcodePairCountComparator());
+
+		debugPrintf("Most frequent opcode pairs, including the fused ones:\n");
+		for (uint i = 0; i < pairs.size() && (int)i < count; i++) {
+			int first = pairs[i] / NUM_OPCODES;
+			int second = pairs[i] % NUM_OPCODES;
+			uint32 n = luaV_opcodeStats.pairCounts[first][second];
+			debugPrintf("%8u %5.1f%% %s %s\n", n, 100.0 * n / total, luaV_opcodeName(first), luaV_opcodeName(second));
+		}
+	} else {
+		debugPrintf("Unknown action '%s'\n", argv[1]);
+	}
+
+	return true;
+}
+
 }
@@ -40,6 +40,7 @@ public:
 	bool cmd_set_renderer(int argc, const char **argv);
 	bool cmd_save(int argc, const char **argv);
 	bool cmd_load(int argc, const char **argv);
+	bool cmd_lua_opcodes(int argc, const char **argv);
 };
 
 }
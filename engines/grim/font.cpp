@@ -26,6 +26,7 @@
 #include "engines/grim/grim.h"
 #include "engines/grim/savegame.h"
 #include "engines/grim/font.h"
+#include "engines/grim/textobject.h"
 #include "engines/grim/resource.h"
 #include "engines/grim/gfx_base.h"
 
@@ -44,6 +45,7 @@ Font::~Font() {
 	delete[] _charHeaders;
 	delete[] _fontData;
 	g_driver->destroyFont(this);
+	TextObject::clearLayoutCache();
 }
 
 void Font::load(const Common::String &filename, Common::SeekableReadStream *data) {
@@ -80,6 +82,7 @@ void Font::load(const Common::String &filename, Common::SeekableReadStream *data
 	data->read(_fontData, _dataSize);
 
 	g_driver->createFont(this);
+	TextObject::clearLayoutCache();
 }
 
 uint16 Font::getCharIndex(unsigned char c) const {
@@ -1412,6 +1412,9 @@ void GfxOpenGL::drawTextObject(const TextObject *text) {
 	GLuint texture = userData->texture;
 	const Common::String *lines = text->getLines();
 	int numLines = text->getNumLines();
+	// All the glyphs come from the font texture, draw them in a single batch
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glBegin(GL_QUADS);
 	for (int j = 0; j < numLines; ++j) {
 		const Common::String &line = lines[j];
 		int x = text->getLineX(j);
@@ -1424,11 +1427,9 @@ void GfxOpenGL::drawTextObject(const TextObject *text) {
 			float z = x + font->getCharStartingCol(character);
 			z *= _scaleW;
 			w *= _scaleH;
-			glBindTexture(GL_TEXTURE_2D, texture);
 			float width = 1 / 16.f;
 			float cx = ((character - 1) % 16) / 16.0f;
 			float cy = ((character - 1) / 16) / 16.0f;
-			glBegin(GL_QUADS);
 			glTexCoord2f(cx, cy);
 			glVertex2f(z, w);
 			glTexCoord2f(cx + width, cy);
@@ -1437,10 +1438,10 @@ void GfxOpenGL::drawTextObject(const TextObject *text) {
 			glVertex2f(z + sizeW, w + sizeH);
 			glTexCoord2f(cx, cy + width);
 			glVertex2f(z, w + sizeH);
-			glEnd();
 			x += font->getCharKernedWidth(character);
 		}
 	}
+	glEnd();
 
 	glColor3f(1, 1, 1);
 
@@ -28,6 +28,7 @@
 #include "graphics/colormasks.h"
 
 #include "math/glmath.h"
+#include "math/vector4d.h"
 
 #include "engines/grim/actor.h"
 #include "engines/grim/colormap.h"
@@ -44,6 +45,12 @@
 
 namespace Grim {
 
+struct ShadowMaskUserData {
+	byte *_mask;
+	uint32 _maskCapacity;
+	Common::Rect _maskRect;
+};
+
 GfxBase *CreateGfxTinyGL() {
 	return new GfxTinyGL();
 }
@@ -71,6 +78,12 @@ GfxTinyGL::~GfxTinyGL() {
 	for (int i = 0; i < 96; i++) {
 		Graphics::tglDeleteBlitImage(_emergFont[i]);
 	}
+	for (uint i = 0; i < _shadowMaskPool.size(); i++) {
+		delete[] _shadowMaskPool[i]._data;
+	}
+	for (uint i = 0; i < _releasedShadowMasks.size(); i++) {
+		delete[] _releasedShadowMasks[i]._data;
+	}
 	if (_zb) {
 		TinyGL::glClose();
 		delete _zb;
@@ -181,6 +194,7 @@ void GfxTinyGL::clearDepthBuffer() {
 
 void GfxTinyGL::flipBuffer() {
 	TinyGL::tglPresentBuffer();
+	recycleReleasedShadowMasks();
 	g_system->updateScreen();
 }
 
@@ -446,6 +460,11 @@ void GfxTinyGL::getActorScreenBBox(const Actor *actor, Common::Point &p1, Common
 
 
 void GfxTinyGL::startActorDraw(const Actor *actor) {
+	// The shadow mask may not have been built yet, e.g. right after a savegame
+	// has been restored, so build it before drawing the actor on top of it.
+	if (_currentShadowArray && !_currentShadowArray->userData)
+		drawShadowPlanes();
+
 	_currentActor = actor;
 	tglEnable(TGL_TEXTURE_2D);
 	tglMatrixMode(TGL_PROJECTION);
@@ -461,19 +480,16 @@ void GfxTinyGL::startActorDraw(const Actor *actor) {
 
 	if (_currentShadowArray) {
 		tglDepthMask(TGL_FALSE);
-		// TODO find out why shadowMask at device in woods is null
-		if (!_currentShadowArray->shadowMask) {
-			_currentShadowArray->shadowMask = new byte[_gameWidth * _gameHeight];
-			_currentShadowArray->shadowMaskSize = _gameWidth * _gameHeight;
-		}
-		assert(_currentShadowArray->shadowMask);
 		//tglSetShadowColor(255, 255, 255);
 		if (g_grim->getGameType() == GType_GRIM) {
 			tglSetShadowColor(_shadowColorR, _shadowColorG, _shadowColorB);
 		} else {
 			tglSetShadowColor(_currentShadowArray->color.getRed(), _currentShadowArray->color.getGreen(), _currentShadowArray->color.getBlue());
 		}
-		tglSetShadowMaskBuf(_currentShadowArray->shadowMask);
+		const ShadowMaskUserData *sud = static_cast<ShadowMaskUserData *>(_currentShadowArray->userData);
+		assert(sud && sud->_mask);
+		const Common::Rect &maskRect = sud->_maskRect;
+		tglSetShadowMaskBuf(sud->_mask, maskRect.left, maskRect.top, maskRect.width(), maskRect.height());
 		SectorListType::iterator i = _currentShadowArray->planeList.begin();
 		Sector *shadowSector = i->sector;
 		tglShadowProjection(_currentShadowArray->pos, shadowSector->getVertices()[0], shadowSector->getNormal(), _currentShadowArray->dontNegate);
@@ -558,21 +574,35 @@ void GfxTinyGL::drawShadowPlanes() {
 		tglTranslatef(-_currentPos.x(), -_currentPos.y(), -_currentPos.z());
 	}
 
-	if (!_currentShadowArray->shadowMask) {
-		_currentShadowArray->shadowMask = new byte[_gameWidth * _gameHeight];
-		_currentShadowArray->shadowMaskSize = _gameWidth * _gameHeight;
+	ShadowMaskUserData *sud = static_cast<ShadowMaskUserData *>(_currentShadowArray->userData);
+	if (!sud) {
+		sud = new ShadowMaskUserData;
+		sud->_mask = nullptr;
+		sud->_maskCapacity = 0;
+		_currentShadowArray->userData = sud;
 	}
-	memset(_currentShadowArray->shadowMask, 0, _gameWidth * _gameHeight);
 
-	tglSetShadowMaskBuf(_currentShadowArray->shadowMask);
-	_currentShadowArray->planeList.begin();
-	for (SectorListType::iterator i = _currentShadowArray->planeList.begin(); i != _currentShadowArray->planeList.end(); ++i) {
-		Sector *shadowSector = i->sector;
-		tglBegin(TGL_POLYGON);
-		for (int k = 0; k < shadowSector->getNumVertices(); k++) {
-			tglVertex3f(shadowSector->getVertices()[k].x(), shadowSector->getVertices()[k].y(), shadowSector->getVertices()[k].z());
+	// The mask only needs to cover the screen area of the shadow planes,
+	// since the shadows are projected onto them.
+	sud->_maskRect = getShadowPlanesScreenRect(_currentShadowArray);
+	const Common::Rect &maskRect = sud->_maskRect;
+	uint32 maskSize = maskRect.width() * maskRect.height();
+	if (!sud->_mask || maskSize > sud->_maskCapacity) {
+		releaseShadowMask(sud->_mask, sud->_maskCapacity);
+		sud->_mask = allocateShadowMask(maskSize, sud->_maskCapacity);
+	}
+	memset(sud->_mask, 0, maskSize);
+
+	tglSetShadowMaskBuf(sud->_mask, maskRect.left, maskRect.top, maskRect.width(), maskRect.height());
+	if (!maskRect.isEmpty()) {
+		for (SectorListType::iterator i = _currentShadowArray->planeList.begin(); i != _currentShadowArray->planeList.end(); ++i) {
+			Sector *shadowSector = i->sector;
+			tglBegin(TGL_POLYGON);
+			for (int k = 0; k < shadowSector->getNumVertices(); k++) {
+				tglVertex3f(shadowSector->getVertices()[k].x(), shadowSector->getVertices()[k].y(), shadowSector->getVertices()[k].z());
+			}
+			tglEnd();
 		}
-		tglEnd();
 	}
 	tglSetShadowMaskBuf(nullptr);
 	tglDisable(TGL_SHADOW_MASK_MODE);
@@ -581,6 +611,106 @@ void GfxTinyGL::drawShadowPlanes() {
 	tglPopMatrix();
 }
 
+void GfxTinyGL::destroyShadow(Shadow *shadow) {
+	ShadowMaskUserData *sud = static_cast<ShadowMaskUserData *>(shadow->userData);
+	if (sud) {
+		releaseShadowMask(sud->_mask, sud->_maskCapacity);
+		delete sud;
+	}
+
+	shadow->userData = nullptr;
+}
+
+Common::Rect GfxTinyGL::getShadowPlanesScreenRect(const Shadow *shadow) {
+	TGLfloat modelView[16], projection[16];
+	TGLint viewPort[4];
+	tglGetFloatv(TGL_MODELVIEW_MATRIX, modelView);
+	tglGetFloatv(TGL_PROJECTION_MATRIX, projection);
+	tglGetIntegerv(TGL_VIEWPORT, viewPort);
+
+	Math::Matrix4 modelMatrix, projMatrix;
+	for (int i = 0; i < 4; i++) {
+		for (int j = 0; j < 4; j++) {
+			modelMatrix(j, i) = modelView[j * 4 + i];
+			projMatrix(j, i) = projection[j * 4 + i];
+		}
+	}
+
+	const Common::Rect screenRect(_screenWidth, _screenHeight);
+	float left = 1e10f, top = 1e10f, right = -1e10f, bottom = -1e10f;
+	for (SectorListType::const_iterator i = shadow->planeList.begin(); i != shadow->planeList.end(); ++i) {
+		Sector *shadowSector = i->sector;
+		for (int k = 0; k < shadowSector->getNumVertices(); k++) {
+			const Math::Vector3d &v = shadowSector->getVertices()[k];
+			Math::Vector4d pos(v.x(), v.y(), v.z(), 1.0f);
+			pos = projMatrix.transform(modelMatrix.transform(pos));
+			// A vertex behind the eye does not project to a bounded area,
+			// fall back to a mask covering the whole screen.
+			if (pos.w() <= 0.0f)
+				return screenRect;
+
+			float x = viewPort[0] + (1.0f + pos.x() / pos.w()) * viewPort[2] / 2.0f;
+			float y = viewPort[1] + (1.0f - pos.y() / pos.w()) * viewPort[3] / 2.0f;
+			left = MIN(left, x);
+			right = MAX(right, x);
+			top = MIN(top, y);
+			bottom = MAX(bottom, y);
+		}
+	}
+
+	if (left > right || top > bottom)
+		return Common::Rect();
+
+	// Leave some room for the rounding done by the rasterizer.
+	Common::Rect rect;
+	rect.left = (int16)CLIP<float>(floorf(left) - 2.0f, screenRect.left, screenRect.right);
+	rect.top = (int16)CLIP<float>(floorf(top) - 2.0f, screenRect.top, screenRect.bottom);
+	rect.right = (int16)CLIP<float>(ceilf(right) + 3.0f, screenRect.left, screenRect.right);
+	rect.bottom = (int16)CLIP<float>(ceilf(bottom) + 3.0f, screenRect.top, screenRect.bottom);
+	if (!rect.isValidRect())
+		return Common::Rect();
+	return rect;
+}
+
+byte *GfxTinyGL::allocateShadowMask(uint32 size, uint32 &capacity) {
+	// Masks are never empty, the rasterizer expects a valid buffer even
+	// when the shadow planes are off screen.
+	size = MAX<uint32>(size, 1);
+
+	// Reuse the smallest pooled buffer that is large enough.
+	int best = -1;
+	for (uint i = 0; i < _shadowMaskPool.size(); i++) {
+		if (_shadowMaskPool[i]._capacity >= size && (best == -1 || _shadowMaskPool[i]._capacity < _shadowMaskPool[best]._capacity))
+			best = i;
+	}
+
+	if (best == -1) {
+		capacity = size;
+		return new byte[size];
+	}
+
+	byte *data = _shadowMaskPool[best]._data;
+	capacity = _shadowMaskPool[best]._capacity;
+	_shadowMaskPool.remove_at(best);
+	return data;
+}
+
+void GfxTinyGL::releaseShadowMask(byte *data, uint32 capacity) {
+	if (!data)
+		return;
+
+	ShadowMaskBuffer buffer;
+	buffer._data = data;
+	buffer._capacity = capacity;
+	_releasedShadowMasks.push_back(buffer);
+}
+
+void GfxTinyGL::recycleReleasedShadowMasks() {
+	// The frame has been presented, no draw call references the buffers anymore
+	_shadowMaskPool.push_back(_releasedShadowMasks);
+	_releasedShadowMasks.clear();
+}
+
 void GfxTinyGL::setShadowMode() {
 	GfxBase::setShadowMode();
 	tglEnable(TGL_SHADOW_MODE);
@@ -1010,9 +1140,14 @@ void GfxTinyGL::createFont(Font *font) {
 void GfxTinyGL::destroyFont(Font *font) {
 }
 
+struct TextGlyph {
+	int x, y;
+	byte ch;
+};
+
 struct TextObjectData {
 	Graphics::BlitImage *image;
-	int width, height, x, y;
+	int x, y;
 };
 
 void GfxTinyGL::createTextObject(TextObject *text) {
@@ -1020,93 +1155,105 @@ void GfxTinyGL::createTextObject(TextObject *text) {
 	const Common::String *lines = text->getLines();
 	const Font *font = text->getFont();
 	const Color &fgColor = text->getFGColor();
-	TextObjectData *userData = new TextObjectData[numLines];
+
+	TextObjectData *userData = new TextObjectData;
+	userData->image = nullptr;
+	userData->x = 0;
+	userData->y = 0;
 	text->setUserData(userData);
-	uint32 kKitmapColorkey = _pixelFormat.RGBToColor(0, 255, 0);
-	const uint32 blackColor = _pixelFormat.RGBToColor(0, 0, 0);
-	const uint32 color = _pixelFormat.RGBToColor(fgColor.getRed(), fgColor.getGreen(), fgColor.getBlue());
-	while (color == kKitmapColorkey || blackColor == kKitmapColorkey) {
-		kKitmapColorkey += 1;
-	}
+
+	// Place the glyphs of all the lines, then compose the whole text object
+	// into a single blit image so that drawing it is one blit per frame
+	Common::Array<TextGlyph> glyphs;
+	Common::Rect bounds;
+
 	for (int j = 0; j < numLines; j++) {
 		const Common::String &currentLine = lines[j];
 
-		int width = font->getBitmapStringLength(currentLine) + 1;
-		int height = font->getStringHeight(currentLine) + 1;
-
-		uint8 *_textBitmap = new uint8[height * width];
-		memset(_textBitmap, 0, height * width);
-
-		int startColumn = 0;
-		for (unsigned int d = 0; d < currentLine.size(); d++) {
-			int ch = currentLine[d];
-			int32 charBitmapWidth = font->getCharBitmapWidth(ch);
-			int8 fontRow = font->getCharStartingLine(ch) + font->getBaseOffsetY();
-			int8 fontCol = font->getCharStartingCol(ch);
-
-			for (int line = 0; line < font->getCharBitmapHeight(ch); line++) {
-				int lineOffset = ((fontRow + line) * width);
-				for (int bitmapCol = 0; bitmapCol < charBitmapWidth; bitmapCol++) {
-					int columnOffset = startColumn + fontCol + bitmapCol;
-					int fontOffset = (charBitmapWidth * line) + bitmapCol;
-					int8 pixel = font->getCharData(ch)[fontOffset];
-					assert(lineOffset + columnOffset < width*height);
-					if (pixel != 0)
-						_textBitmap[lineOffset + columnOffset] = pixel;
-				}
-			}
-			startColumn += font->getCharKernedWidth(ch);
+		int x = text->getLineX(j);
+		int y = text->getLineY(j);
+		if (g_grim->getGameType() == GType_MONKEY4) {
+			y -= font->getBaseOffsetY();
+			if (y < 0)
+				y = 0;
 		}
-
-		Graphics::PixelBuffer buf(_pixelFormat, width * height, DisposeAfterUse::YES);
-
-		uint8 *bitmapData = _textBitmap;
-
-		int txData = 0;
-		for (int i = 0; i < width * height; i++, txData++, bitmapData++) {
-			byte pixel = *bitmapData;
-			if (pixel == 0x00) {
-				buf.setPixelAt(txData, kKitmapColorkey);
-			} else if (pixel == 0x80) {
-				buf.setPixelAt(txData, blackColor);
-			} else if (pixel == 0xFF) {
-				buf.setPixelAt(txData, color);
-			}
+		y += font->getBaseOffsetY();
+
+		for (uint d = 0; d < currentLine.size(); d++) {
+			byte ch = currentLine[d];
+			TextGlyph glyph;
+			glyph.x = x + font->getCharStartingCol(ch);
+			glyph.y = y + font->getCharStartingLine(ch);
+			glyph.ch = ch;
+			x += font->getCharKernedWidth(ch);
+
+			Common::Rect glyphRect(glyph.x, glyph.y,
+			                       glyph.x + font->getCharBitmapWidth(ch),
+			                       glyph.y + font->getCharBitmapHeight(ch));
+			if (glyphRect.isEmpty())
+				continue;
+
+			if (glyphs.empty())
+				bounds = glyphRect;
+			else
+				bounds.extend(glyphRect);
+			glyphs.push_back(glyph);
 		}
+	}
 
-		userData[j].width = width;
-		userData[j].height = height;
+	if (glyphs.empty())
+		return;
 
-		Graphics::Surface sourceSurface;
-		sourceSurface.setPixels(buf.getRawBuffer());
-		sourceSurface.format = buf.getFormat();
-		sourceSurface.w = width;
-		sourceSurface.h = height;
-		sourceSurface.pitch = sourceSurface.w * buf.getFormat().bytesPerPixel;
-		userData[j].image = Graphics::tglGenBlitImage();
-		Graphics::tglUploadBlitImage(userData[j].image, sourceSurface, kKitmapColorkey, true);
-		userData[j].x = text->getLineX(j);
-		userData[j].y = text->getLineY(j);
+	uint32 colorKey = _pixelFormat.RGBToColor(0, 255, 0);
+	const uint32 blackColor = _pixelFormat.RGBToColor(0, 0, 0);
+	const uint32 color = _pixelFormat.RGBToColor(fgColor.getRed(), fgColor.getGreen(), fgColor.getBlue());
+	while (color == colorKey || blackColor == colorKey) {
+		colorKey += 1;
+	}
 
-		if (g_grim->getGameType() == GType_MONKEY4) {
-			userData[j].y -= font->getBaseOffsetY();
-			if (userData[j].y < 0)
-				userData[j].y = 0;
-		}
+	int width = bounds.width();
+	int height = bounds.height();
+	Graphics::PixelBuffer buf(_pixelFormat, width * height, DisposeAfterUse::YES);
+	for (int i = 0; i < width * height; i++) {
+		buf.setPixelAt(i, colorKey);
+	}
 
-		delete[] _textBitmap;
+	for (uint i = 0; i < glyphs.size(); i++) {
+		const TextGlyph &glyph = glyphs[i];
+		int glyphWidth = font->getCharBitmapWidth(glyph.ch);
+		int glyphHeight = font->getCharBitmapHeight(glyph.ch);
+		const byte *data = font->getCharData(glyph.ch);
+
+		for (int row = 0; row < glyphHeight; row++) {
+			int offset = (glyph.y - bounds.top + row) * width + glyph.x - bounds.left;
+			for (int col = 0; col < glyphWidth; col++, data++) {
+				if (*data == 0x80) {
+					buf.setPixelAt(offset + col, blackColor);
+				} else if (*data == 0xFF) {
+					buf.setPixelAt(offset + col, color);
+				}
+			}
+		}
 	}
+
+	Graphics::Surface sourceSurface;
+	sourceSurface.setPixels(buf.getRawBuffer());
+	sourceSurface.format = buf.getFormat();
+	sourceSurface.w = width;
+	sourceSurface.h = height;
+	sourceSurface.pitch = sourceSurface.w * buf.getFormat().bytesPerPixel;
+	userData->image = Graphics::tglGenBlitImage();
+	Graphics::tglUploadBlitImage(userData->image, sourceSurface, colorKey, true);
+	userData->x = bounds.left;
+	userData->y = bounds.top;
 }
 
 void GfxTinyGL::drawTextObject(const TextObject *text) {
 	const TextObjectData *userData = (const TextObjectData *)text->getUserData();
-	if (userData) {
+	if (userData && userData->image) {
 		tglEnable(TGL_BLEND);
 		tglBlendFunc(TGL_SRC_ALPHA, TGL_ONE_MINUS_SRC_ALPHA);
-		int numLines = text->getNumLines();
-		for (int i = 0; i < numLines; ++i) {
-			Graphics::tglBlit(userData[i].image, userData[i].x, userData[i].y);
-		}
+		Graphics::tglBlit(userData->image, userData->x, userData->y);
 		tglDisable(TGL_BLEND);
 	}
 }
@@ -1114,11 +1261,10 @@ void GfxTinyGL::drawTextObject(const TextObject *text) {
 void GfxTinyGL::destroyTextObject(TextObject *text) {
 	const TextObjectData *userData = (const TextObjectData *)text->getUserData();
 	if (userData) {
-		int numLines = text->getNumLines();
-		for (int i = 0; i < numLines; ++i) {
-			Graphics::tglDeleteBlitImage(userData[i].image);
-		}
-		delete[] userData;
+		if (userData->image)
+			Graphics::tglDeleteBlitImage(userData->image);
+		delete userData;
+		text->setUserData(nullptr);
 	}
 }
 
@@ -1276,6 +1422,7 @@ void GfxTinyGL::createSpecialtyTextureFromScreen(uint id, uint8 *data, int x, in
 
 void GfxTinyGL::storeDisplay() {
 	TinyGL::tglPresentBuffer();
+	recycleReleasedShadowMasks();
 	_zb->copyToBuffer(_storedDisplay);
 }
 
@@ -69,6 +69,7 @@ public:
 	void clearShadowMode() override;
 	void setShadowColor(byte r, byte g, byte b) override;
 	void getShadowColor(byte *r, byte *g, byte *b) override;
+	void destroyShadow(Shadow *shadow) override;
 
 	void set3DMode() override;
 
@@ -137,6 +138,21 @@ private:
 	const Actor *_currentActor;
 	TGLenum _depthFunc;
 
+	struct ShadowMaskBuffer {
+		byte *_data;
+		uint32 _capacity;
+	};
+	// Shadow mask buffers not currently used by any shadow
+	Common::Array<ShadowMaskBuffer> _shadowMaskPool;
+	// Shadow mask buffers released during the current frame. The deferred
+	// draw calls may still reference them until the frame is presented.
+	Common::Array<ShadowMaskBuffer> _releasedShadowMasks;
+
+	Common::Rect getShadowPlanesScreenRect(const Shadow *shadow);
+	byte *allocateShadowMask(uint32 size, uint32 &capacity);
+	void releaseShadowMask(byte *data, uint32 capacity);
+	void recycleReleasedShadowMasks();
+
 	void readPixels(int x, int y, int width, int height, uint8 *buffer);
 };
 
@@ -41,6 +41,7 @@
 #endif
 
 #include "gui/error.h"
+#include "gui/EventRecorder.h"
 #include "gui/gui-manager.h"
 #include "gui/message.h"
 
@@ -71,6 +72,7 @@
 #include "engines/grim/sound.h"
 #include "engines/grim/stuffit.h"
 #include "engines/grim/debugger.h"
+#include "engines/grim/benchmark.h"
 
 #include "engines/grim/imuse/imuse.h"
 #include "engines/grim/emi/sound/emisound.h"
@@ -144,6 +146,15 @@ GrimEngine::GrimEngine(OSystem *syst, uint32 gameFlags, GrimGameType gameType, C
 	_savedState = nullptr;
 	_fps[0] = 0;
 	_iris = new Iris();
+	_benchmark = nullptr;
+	if (ConfMan.hasKey("benchmark")) {
+		// Run as fast as possible, the benchmark measures the CPU time of each frame
+		_benchmark = new Benchmark(ConfMan.get("benchmark"));
+		_speedLimitMs = 0;
+#ifdef ENABLE_EVENTRECORDER
+		g_eventRec.setFastPlayback(true);
+#endif
+	}
 	_buildActiveActorsList = false;
 
 	Color c(0, 0, 0);
@@ -209,6 +220,7 @@ GrimEngine::~GrimEngine() {
 	g_driver = nullptr;
 	delete _iris;
 	delete _debugger;
+	delete _benchmark;
 
 	ConfMan.flushToDisk();
 	DebugMan.clearAllDebugChannels();
@@ -234,6 +246,10 @@ LuaBase *GrimEngine::createLua() {
 
 GfxBase *GrimEngine::createRenderer(int screenW, int screenH, bool fullscreen) {
 	Common::String rendererConfig = ConfMan.get("renderer");
+	if (_benchmark) {
+		// Benchmarks need to run without a GPU
+		rendererConfig = "software";
+	}
 	Graphics::RendererType desiredRendererType = Graphics::parseRendererTypeCode(rendererConfig);
 	Graphics::RendererType matchingRendererType = Graphics::getBestMatchingAvailableRendererType(desiredRendererType);
 
@@ -566,9 +582,16 @@ void GrimEngine::luaUpdate() {
 		_frameTime = 0;
 	}
 
+	if (_benchmark)
+		_benchmark->beginPhase(Benchmark::kPhaseLua);
 	LuaBase::instance()->update(_frameTime, _movieTime);
+	if (_benchmark)
+		_benchmark->endPhase(Benchmark::kPhaseLua);
 
 	if (_currSet && (_mode == NormalMode || _mode == SmushMode)) {
+		if (_benchmark)
+			_benchmark->beginPhase(Benchmark::kPhaseActors);
+
 		// call updateTalk() before calling update(), since it may modify costumes state, and
 		// the costumes are updated in update().
 		for (Common::List<Actor *>::iterator i = _talkingActors.begin(); i != _talkingActors.end(); ++i) {
@@ -593,6 +616,9 @@ void GrimEngine::luaUpdate() {
 		foreach (TextObject *t, TextObject::getPool()) {
 			t->update();
 		}
+
+		if (_benchmark)
+			_benchmark->endPhase(Benchmark::kPhaseActors);
 	}
 }
 
@@ -725,8 +751,13 @@ void GrimEngine::doFlip() {
 	if (_showFps && _mode != DrawMode)
 		g_driver->drawEmergString(550, 25, _fps, Color(255, 255, 255));
 
-	if (_flipEnable)
+	if (_flipEnable) {
+		if (_benchmark)
+			_benchmark->beginPhase(Benchmark::kPhaseRasterize);
 		g_driver->flipBuffer();
+		if (_benchmark)
+			_benchmark->endPhase(Benchmark::kPhaseRasterize);
+	}
 
 	if (_showFps && _mode != DrawMode) {
 		unsigned int currentTime = g_system->getMillis();
@@ -765,6 +796,9 @@ void GrimEngine::mainLoop() {
 		if (shouldQuit())
 			return;
 
+		if (_benchmark)
+			_benchmark->beginFrame();
+
 		if (_savegameLoadRequest) {
 			savegameRestore();
 		}
@@ -886,7 +920,11 @@ void GrimEngine::mainLoop() {
 			// called the cpu must wait for the gpu to finish its queue.
 			// Now, it will queue all the OpenGL commands and draw them on the
 			// GPU while the CPU is busy updating the game world.
+			if (_benchmark)
+				_benchmark->beginPhase(Benchmark::kPhaseDraw);
 			updateDisplayScene();
+			if (_benchmark)
+				_benchmark->endPhase(Benchmark::kPhaseDraw);
 		}
 
 		if (_mode != PauseMode) {
@@ -903,6 +941,9 @@ void GrimEngine::mainLoop() {
 			g_imuseState = -1;
 		}
 
+		if (_benchmark)
+			_benchmark->endFrame();
+
 		uint32 endTime = g_system->getMillis();
 		if (startTime > endTime)
 			continue;
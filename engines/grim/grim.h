@@ -46,6 +46,7 @@ class Set;
 class TextObject;
 class PrimitiveObject;
 class Debugger;
+class Benchmark;
 class LuaBase;
 class GfxBase;
 
@@ -115,6 +116,7 @@ public:
 	void mainLoop();
 	unsigned getFrameStart() const { return _frameStart; }
 	unsigned getFrameTime() const { return _frameTime; }
+	Benchmark *getBenchmark() const { return _benchmark; }
 
 	// perSecond should allow rates of zero, some actors will accelerate
 	// up to their normal speed (such as the bone wagon) so handling
@@ -258,6 +260,7 @@ protected:
 	Common::Platform _gamePlatform;
 	Common::Language _gameLanguage;
 	Debugger *_debugger;
+	Benchmark *_benchmark;
 	uint32 _pauseStartTime;
 };
 
@@ -171,6 +171,55 @@ typedef enum {
 	POP1			//	-		-				-				TOP-=2
 } OpCode;
 
+#define NUM_OPCODES (POP1 + 1)
+
+/*
+** Superinstructions: an opcode without parameter followed by any variant of a
+** second opcode, executed with a single dispatch. They are only created by
+** luaU_fuseOpcodes() when loading precompiled chunks; the fused opcode replaces
+** the first opcode byte in place, so code size, jump offsets and the second
+** instruction are left untouched, and luaU_unfuseOpcode() gives back the
+** original opcode.
+*/
+typedef enum {
+	PUSHLOCAL0_GETDOTTED = NUM_OPCODES,
+	PUSHLOCAL1_GETDOTTED,
+	PUSHLOCAL2_GETDOTTED,
+	PUSHLOCAL3_GETDOTTED,
+	PUSHLOCAL4_GETDOTTED,
+	PUSHLOCAL5_GETDOTTED,
+	PUSHLOCAL6_GETDOTTED,
+	PUSHLOCAL7_GETDOTTED,
+
+	GETGLOBAL0_GETDOTTED,
+	GETGLOBAL1_GETDOTTED,
+	GETGLOBAL2_GETDOTTED,
+	GETGLOBAL3_GETDOTTED,
+	GETGLOBAL4_GETDOTTED,
+	GETGLOBAL5_GETDOTTED,
+	GETGLOBAL6_GETDOTTED,
+	GETGLOBAL7_GETDOTTED,
+
+	PUSHLOCAL0_CALLFUNC,
+	PUSHLOCAL1_CALLFUNC,
+	PUSHLOCAL2_CALLFUNC,
+	PUSHLOCAL3_CALLFUNC,
+	PUSHLOCAL4_CALLFUNC,
+	PUSHLOCAL5_CALLFUNC,
+	PUSHLOCAL6_CALLFUNC,
+	PUSHLOCAL7_CALLFUNC,
+
+	GETGLOBAL0_CALLFUNC,
+	GETGLOBAL1_CALLFUNC,
+	GETGLOBAL2_CALLFUNC,
+	GETGLOBAL3_CALLFUNC,
+	GETGLOBAL4_CALLFUNC,
+	GETGLOBAL5_CALLFUNC,
+	GETGLOBAL6_CALLFUNC,
+	GETGLOBAL7_CALLFUNC,
+	NUM_FUSED_OPCODES
+} FusedOpCode;
+
 #define RFIELDS_PER_FLUSH 32	// records (SETMAP)
 #define LFIELDS_PER_FLUSH 64    // lists (SETLIST)
 #define ZEROVARARG	64
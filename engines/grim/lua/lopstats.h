@@ -0,0 +1,31 @@
+/*
+** Lua virtual machine executed opcode statistics
+** See Copyright Notice in lua.h
+*/
+
+#ifndef GRIM_LOPSTATS_H
+#define GRIM_LOPSTATS_H
+
+#include "common/scummsys.h"
+
+#include "engines/grim/lua/lopcodes.h"
+
+namespace Grim {
+
+// Executed opcode counts, to find out which superinstructions are worthwhile
+struct LuaOpcodeStats {
+	bool enabled;
+	int32 lastOpcode;
+	uint32 counts[256];
+	// Superinstructions are counted as the pair of opcodes they replace
+	uint32 pairCounts[NUM_OPCODES][NUM_OPCODES];
+};
+
+extern LuaOpcodeStats luaV_opcodeStats;
+void luaV_countOpcode(int32 op, const byte *next);
+void luaV_resetOpcodeStats();
+const char *luaV_opcodeName(int32 op);
+
+} // end of namespace Grim
+
+#endif
@@ -17,6 +17,7 @@
 #include "engines/grim/lua/lstring.h"
 #include "engines/grim/lua/lstate.h"
 #include "engines/grim/lua/lua.h"
+#include "engines/grim/lua/lundump.h"
 
 namespace Grim {
 
@@ -333,6 +334,7 @@ void lua_Restore(SaveGame *savedState) {
 		int32 codeSize = savedState->readLESint32();
 		tempProtoFunc->code = (byte *)luaM_malloc(codeSize);
 		savedState->read(tempProtoFunc->code, codeSize);
+		luaU_fuseOpcodes(tempProtoFunc->code, codeSize);
 		arraysObj->object = tempProtoFunc;
 		arraysObj++;
 	}
@@ -16,6 +16,7 @@
 #include "engines/grim/lua/lopcodes.h"
 #include "engines/grim/lua/lstring.h"
 #include "engines/grim/lua/lua.h"
+#include "engines/grim/lua/lundump.h"
 
 namespace Grim {
 
@@ -100,22 +101,6 @@ static void saveObjectValue(TObject *object, SaveGame *savedState) {
 	}
 }
 
-static int32 opcodeSizeTable[] = {
-	1, 2, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 3, 2, 1,
-	1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 3,
-	1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1,
-	3, 2, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1,
-	1, 1, 1, 3, 1, 2, 3, 2, 4, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-	1, 1, 1, 1, 1, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 1, 1,
-	3, 2, 2, 2, 2, 3, 2, 1, 1, 1, 2, 1, 2, 1, 1, 1, 3, 2, 1, 1,
-	1, 1, 1, 1, 1, 1, 3, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2,
-	1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 3,
-	2, 1, 1, 1, 1, 1, 1, 1, 1, 3, 2, 1, 1, 3, 2, 1, 1, 1, 1, 1,
-	1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 2, 3, 2, 4, 2, 1,
-	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 2, 3, 2, 3,
-	2, 3, 2, 3, 2, 3, 2, 1, 1, 3, 2, 2, 2, 2, 3, 2, 1, 1
-};
-
 void lua_Save(SaveGame *savedState) {
 	savedState->beginSection('LUAS');
 
@@ -264,12 +249,21 @@ void lua_Save(SaveGame *savedState) {
 		byte *tmpPtr = codePtr;
 		int32 opcodeId;
 		do {
-			opcodeId = *tmpPtr;
-			tmpPtr += opcodeSizeTable[opcodeId];
+			opcodeId = luaU_unfuseOpcode(*tmpPtr);
+			tmpPtr += luaU_opcodeSize(opcodeId);
 		} while (opcodeId != ENDCODE);
 		int32 codeSize = (tmpPtr - codePtr) + 2;
 		savedState->writeLESint32(codeSize);
-		savedState->write(tempProtoFunc->code, codeSize);
+		// Superinstructions are not saved, so that savegames stay compatible
+		// between builds. They are created again when restoring.
+		savedState->write(tempProtoFunc->code, 2);
+		for (tmpPtr = codePtr; tmpPtr < codePtr + codeSize - 2;) {
+			opcodeId = luaU_unfuseOpcode(*tmpPtr);
+			int32 opcodeSize = luaU_opcodeSize(opcodeId);
+			savedState->writeByte(opcodeId);
+			savedState->write(tmpPtr + 1, opcodeSize - 1);
+			tmpPtr += opcodeSize;
+		}
 		tempProtoFunc = (TProtoFunc *)tempProtoFunc->head.next;
 	}
 
@@ -6,6 +6,7 @@
 #include "engines/grim/lua/lauxlib.h"
 #include "engines/grim/lua/lfunc.h"
 #include "engines/grim/lua/lmem.h"
+#include "engines/grim/lua/lopcodes.h"
 #include "engines/grim/lua/lstring.h"
 #include "engines/grim/lua/lundump.h"
 
@@ -122,7 +123,9 @@ static TProtoFunc *LoadFunction(ZIO *Z) {
 	TProtoFunc *tf = luaF_newproto();
 	tf->lineDefined = LoadWord(Z);
 	tf->fileName = LoadTString(Z);
-	tf->code = (byte *)LoadBlock(LoadSize(Z), Z);
+	int32 codeSize = LoadSize(Z);
+	tf->code = (byte *)LoadBlock(codeSize, Z);
+	luaU_fuseOpcodes(tf->code, codeSize);
 	LoadConstants(tf, Z);
 	LoadLocals(tf, Z);
 	LoadFunctions(tf, Z);
@@ -171,6 +174,86 @@ static TProtoFunc *LoadChunk(ZIO *Z) {
 	return LoadFunction(Z);
 }
 
+static const byte opcodeSizeTable[NUM_OPCODES] = {
+	1, 2, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 3, 2, 1,
+	1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 3,
+	1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+	3, 2, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1,
+	1, 1, 1, 3, 1, 2, 3, 2, 4, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 1, 1,
+	3, 2, 2, 2, 2, 3, 2, 1, 1
+};
+
+int32 luaU_opcodeSize(int32 op) {
+	assert(op >= 0 && op < NUM_OPCODES);
+	return opcodeSizeTable[op];
+}
+
+int32 luaU_unfuseOpcode(int32 op) {
+	if (op < NUM_OPCODES)
+		return op;
+	else if (op < GETGLOBAL0_GETDOTTED)
+		return PUSHLOCAL0 + (op - PUSHLOCAL0_GETDOTTED);
+	else if (op < PUSHLOCAL0_CALLFUNC)
+		return GETGLOBAL0 + (op - GETGLOBAL0_GETDOTTED);
+	else if (op < GETGLOBAL0_CALLFUNC)
+		return PUSHLOCAL0 + (op - PUSHLOCAL0_CALLFUNC);
+	else
+		return GETGLOBAL0 + (op - GETGLOBAL0_CALLFUNC);
+}
+
+static int32 fusedOpcode(int32 first, int32 second) {
+	bool getDotted = second >= GETDOTTED && second <= GETDOTTEDW;
+	bool callFunc = second >= CALLFUNC && second <= CALLFUNC1;
+	if (first >= PUSHLOCAL0 && first <= PUSHLOCAL7) {
+		if (getDotted)
+			return PUSHLOCAL0_GETDOTTED + (first - PUSHLOCAL0);
+		if (callFunc)
+			return PUSHLOCAL0_CALLFUNC + (first - PUSHLOCAL0);
+	} else if (first >= GETGLOBAL0 && first <= GETGLOBAL7) {
+		if (getDotted)
+			return GETGLOBAL0_GETDOTTED + (first - GETGLOBAL0);
+		if (callFunc)
+			return GETGLOBAL0_CALLFUNC + (first - GETGLOBAL0);
+	}
+	return -1;
+}
+
+void luaU_fuseOpcodes(byte *code, int32 size) {
+	// The first two bytes are the stack size and the argument count,
+	// see luaV_execute().
+	byte *begin = code + 2;
+	byte *end = code + size;
+
+	// Only touch code which decodes cleanly up to its ENDCODE, anything else
+	// is left for the interpreter to deal with as before.
+	byte *pc = begin;
+	while (true) {
+		if (pc >= end || *pc >= NUM_OPCODES)
+			return;
+		int32 op = *pc;
+		pc += opcodeSizeTable[op];
+		if (op == ENDCODE)
+			break;
+	}
+	if (pc > end)
+		return;
+
+	pc = begin;
+	while (*pc != ENDCODE) {
+		int32 opSize = opcodeSizeTable[*pc];
+		int32 fused = fusedOpcode(*pc, pc[opSize]);
+		if (fused != -1) {
+			*pc = fused;
+			// The second instruction must keep its own opcode, it is decoded
+			// by the superinstruction and may also be a jump target.
+			pc += opSize;
+			opSize = opcodeSizeTable[*pc];
+		}
+		pc += opSize;
+	}
+}
+
 /*
 ** load one chunk from a file or buffer
 ** return main if ok and NULL at EOF
@@ -25,6 +25,10 @@ namespace Grim {
 
 TProtoFunc* luaU_undump1(ZIO* Z);      // load one chunk
 
+int32 luaU_opcodeSize(int32 op);       // size of an instruction, parameters included
+int32 luaU_unfuseOpcode(int32 op);     // first opcode of a superinstruction
+void luaU_fuseOpcodes(byte *code, int32 size);
+
 } // end of namespace Grim
 
 #endif
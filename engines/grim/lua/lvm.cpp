@@ -18,6 +18,7 @@
 #include "engines/grim/lua/ltask.h"
 #include "engines/grim/lua/ltm.h"
 #include "engines/grim/lua/luadebug.h"
+#include "engines/grim/lua/lundump.h"
 #include "engines/grim/lua/lvm.h"
 
 namespace Grim {
@@ -28,6 +29,113 @@ namespace Grim {
 
 #define	EXTRA_STACK	5
 
+/*
+** Opcode dispatch. With GCC and Clang each instruction jumps straight to the
+** handler of the next one through a table of label addresses ("computed
+** goto"), which branch predictors handle much better than the single
+** indirect jump of a switch. Define LUA_NO_COMPUTED_GOTO to build the
+** portable switch version instead.
+*/
+#if defined(__GNUC__) && !defined(LUA_NO_COMPUTED_GOTO)
+#define LUA_USE_COMPUTED_GOTO
+#endif
+
+#define vmfetch() \
+	do { \
+		task->aux = *task->pc++; \
+		if (luaV_opcodeStats.enabled) \
+			luaV_countOpcode(task->aux, task->pc); \
+	} while (0)
+
+#ifdef LUA_USE_COMPUTED_GOTO
+#define vmdispatch(op)	goto *dispatchTable[op];
+#define vmcase(op)		L_##op:
+#define vmdefault		L_default:
+#define vmbreak			vmfetch(); goto *dispatchTable[task->aux]
+#else
+#define vmdispatch(op)	switch (op)
+#define vmcase(op)		case op:
+#define vmdefault		default:
+#define vmbreak			break
+#endif
+
+LuaOpcodeStats luaV_opcodeStats;
+
+static void countOpcodePair(int32 op) {
+	int32 last = luaV_opcodeStats.lastOpcode;
+	if (last >= 0 && last < NUM_OPCODES && op < NUM_OPCODES)
+		luaV_opcodeStats.pairCounts[last][op]++;
+	luaV_opcodeStats.lastOpcode = op;
+}
+
+void luaV_countOpcode(int32 op, const byte *next) {
+	luaV_opcodeStats.counts[op]++;
+	if (op >= NUM_OPCODES && op < NUM_FUSED_OPCODES) {
+		// The second instruction of a superinstruction is not dispatched,
+		// it follows the fused opcode in the code
+		countOpcodePair(luaU_unfuseOpcode(op));
+		countOpcodePair(*next);
+	} else {
+		countOpcodePair(op);
+	}
+}
+
+void luaV_resetOpcodeStats() {
+	memset(luaV_opcodeStats.counts, 0, sizeof(luaV_opcodeStats.counts));
+	memset(luaV_opcodeStats.pairCounts, 0, sizeof(luaV_opcodeStats.pairCounts));
+	luaV_opcodeStats.lastOpcode = -1;
+}
+
+static const char *const opcodeNames[NUM_FUSED_OPCODES] = {
+	"ENDCODE", "PUSHNIL", "PUSHNIL0", "PUSHNUMBER",
+	"PUSHNUMBER0", "PUSHNUMBER1", "PUSHNUMBER2", "PUSHNUMBERW",
+	"PUSHCONSTANT", "PUSHCONSTANT0", "PUSHCONSTANT1", "PUSHCONSTANT2",
+	"PUSHCONSTANT3", "PUSHCONSTANT4", "PUSHCONSTANT5", "PUSHCONSTANT6",
+	"PUSHCONSTANT7", "PUSHCONSTANTW", "PUSHUPVALUE", "PUSHUPVALUE0",
+	"PUSHUPVALUE1", "PUSHLOCAL", "PUSHLOCAL0", "PUSHLOCAL1",
+	"PUSHLOCAL2", "PUSHLOCAL3", "PUSHLOCAL4", "PUSHLOCAL5",
+	"PUSHLOCAL6", "PUSHLOCAL7", "GETGLOBAL", "GETGLOBAL0",
+	"GETGLOBAL1", "GETGLOBAL2", "GETGLOBAL3", "GETGLOBAL4",
+	"GETGLOBAL5", "GETGLOBAL6", "GETGLOBAL7", "GETGLOBALW",
+	"GETTABLE", "GETDOTTED", "GETDOTTED0", "GETDOTTED1",
+	"GETDOTTED2", "GETDOTTED3", "GETDOTTED4", "GETDOTTED5",
+	"GETDOTTED6", "GETDOTTED7", "GETDOTTEDW", "PUSHSELF",
+	"PUSHSELF0", "PUSHSELF1", "PUSHSELF2", "PUSHSELF3",
+	"PUSHSELF4", "PUSHSELF5", "PUSHSELF6", "PUSHSELF7",
+	"PUSHSELFW", "CREATEARRAY", "CREATEARRAY0", "CREATEARRAY1",
+	"CREATEARRAYW", "SETLOCAL", "SETLOCAL0", "SETLOCAL1",
+	"SETLOCAL2", "SETLOCAL3", "SETLOCAL4", "SETLOCAL5",
+	"SETLOCAL6", "SETLOCAL7", "SETGLOBAL", "SETGLOBAL0",
+	"SETGLOBAL1", "SETGLOBAL2", "SETGLOBAL3", "SETGLOBAL4",
+	"SETGLOBAL5", "SETGLOBAL6", "SETGLOBAL7", "SETGLOBALW",
+	"SETTABLE0", "SETTABLE", "SETLIST", "SETLIST0",
+	"SETLISTW", "SETMAP", "SETMAP0", "EQOP",
+	"NEQOP", "LTOP", "LEOP", "GTOP",
+	"GEOP", "ADDOP", "SUBOP", "MULTOP",
+	"DIVOP", "POWOP", "CONCOP", "MINUSOP",
+	"NOTOP", "ONTJMP", "ONTJMPW", "ONFJMP",
+	"ONFJMPW", "JMP", "JMPW", "IFFJMP",
+	"IFFJMPW", "IFTUPJMP", "IFTUPJMPW", "IFFUPJMP",
+	"IFFUPJMPW", "CLOSURE", "CLOSURE0", "CLOSURE1",
+	"CALLFUNC", "CALLFUNC0", "CALLFUNC1", "RETCODE",
+	"SETLINE", "SETLINEW", "POP", "POP0",
+	"POP1", "PUSHLOCAL0_GETDOTTED", "PUSHLOCAL1_GETDOTTED", "PUSHLOCAL2_GETDOTTED",
+	"PUSHLOCAL3_GETDOTTED", "PUSHLOCAL4_GETDOTTED", "PUSHLOCAL5_GETDOTTED", "PUSHLOCAL6_GETDOTTED",
+	"PUSHLOCAL7_GETDOTTED", "GETGLOBAL0_GETDOTTED", "GETGLOBAL1_GETDOTTED", "GETGLOBAL2_GETDOTTED",
+	"GETGLOBAL3_GETDOTTED", "GETGLOBAL4_GETDOTTED", "GETGLOBAL5_GETDOTTED", "GETGLOBAL6_GETDOTTED",
+	"GETGLOBAL7_GETDOTTED", "PUSHLOCAL0_CALLFUNC", "PUSHLOCAL1_CALLFUNC", "PUSHLOCAL2_CALLFUNC",
+	"PUSHLOCAL3_CALLFUNC", "PUSHLOCAL4_CALLFUNC", "PUSHLOCAL5_CALLFUNC", "PUSHLOCAL6_CALLFUNC",
+	"PUSHLOCAL7_CALLFUNC", "GETGLOBAL0_CALLFUNC", "GETGLOBAL1_CALLFUNC", "GETGLOBAL2_CALLFUNC",
+	"GETGLOBAL3_CALLFUNC", "GETGLOBAL4_CALLFUNC", "GETGLOBAL5_CALLFUNC", "GETGLOBAL6_CALLFUNC",
+	"GETGLOBAL7_CALLFUNC"
+};
+
+const char *luaV_opcodeName(int32 op) {
+	if (op < 0 || op >= NUM_FUSED_OPCODES)
+		return "???";
+	return opcodeNames[op];
+}
+
 static TaggedString *strconc(char *l, char *r) {
 	size_t nl = strlen(l);
 	char *buffer = luaL_openspace(nl + strlen(r) + 1);
@@ -241,6 +349,12 @@ static void adjust_varargs(StkId first_extra_arg) {
 	*lua_state->stack.top++ = arg;
 }
 
+#if defined(LUA_USE_COMPUTED_GOTO) && defined(__GNUC__)
+// Label addresses and computed gotos are GNU extensions, only used by luaV_execute
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
 StkId luaV_execute(lua_Task *task) {
 	if (!task->some_flag) {
 		luaD_checkstack((*task->pc++) + EXTRA_STACK);
@@ -254,100 +368,170 @@ StkId luaV_execute(lua_Task *task) {
 	}
 	lua_state->state_counter2++;
 
+#ifdef LUA_USE_COMPUTED_GOTO
+	static const void *const dispatchTable[256] = {
+		&&L_ENDCODE, &&L_PUSHNIL, &&L_PUSHNIL0, &&L_PUSHNUMBER,
+		&&L_PUSHNUMBER0, &&L_PUSHNUMBER1, &&L_PUSHNUMBER2, &&L_PUSHNUMBERW,
+		&&L_PUSHCONSTANT, &&L_PUSHCONSTANT0, &&L_PUSHCONSTANT1, &&L_PUSHCONSTANT2,
+		&&L_PUSHCONSTANT3, &&L_PUSHCONSTANT4, &&L_PUSHCONSTANT5, &&L_PUSHCONSTANT6,
+		&&L_PUSHCONSTANT7, &&L_PUSHCONSTANTW, &&L_PUSHUPVALUE, &&L_PUSHUPVALUE0,
+		&&L_PUSHUPVALUE1, &&L_PUSHLOCAL, &&L_PUSHLOCAL0, &&L_PUSHLOCAL1,
+		&&L_PUSHLOCAL2, &&L_PUSHLOCAL3, &&L_PUSHLOCAL4, &&L_PUSHLOCAL5,
+		&&L_PUSHLOCAL6, &&L_PUSHLOCAL7, &&L_GETGLOBAL, &&L_GETGLOBAL0,
+		&&L_GETGLOBAL1, &&L_GETGLOBAL2, &&L_GETGLOBAL3, &&L_GETGLOBAL4,
+		&&L_GETGLOBAL5, &&L_GETGLOBAL6, &&L_GETGLOBAL7, &&L_GETGLOBALW,
+		&&L_GETTABLE, &&L_GETDOTTED, &&L_GETDOTTED0, &&L_GETDOTTED1,
+		&&L_GETDOTTED2, &&L_GETDOTTED3, &&L_GETDOTTED4, &&L_GETDOTTED5,
+		&&L_GETDOTTED6, &&L_GETDOTTED7, &&L_GETDOTTEDW, &&L_PUSHSELF,
+		&&L_PUSHSELF0, &&L_PUSHSELF1, &&L_PUSHSELF2, &&L_PUSHSELF3,
+		&&L_PUSHSELF4, &&L_PUSHSELF5, &&L_PUSHSELF6, &&L_PUSHSELF7,
+		&&L_PUSHSELFW, &&L_CREATEARRAY, &&L_CREATEARRAY0, &&L_CREATEARRAY1,
+		&&L_CREATEARRAYW, &&L_SETLOCAL, &&L_SETLOCAL0, &&L_SETLOCAL1,
+		&&L_SETLOCAL2, &&L_SETLOCAL3, &&L_SETLOCAL4, &&L_SETLOCAL5,
+		&&L_SETLOCAL6, &&L_SETLOCAL7, &&L_SETGLOBAL, &&L_SETGLOBAL0,
+		&&L_SETGLOBAL1, &&L_SETGLOBAL2, &&L_SETGLOBAL3, &&L_SETGLOBAL4,
+		&&L_SETGLOBAL5, &&L_SETGLOBAL6, &&L_SETGLOBAL7, &&L_SETGLOBALW,
+		&&L_SETTABLE0, &&L_SETTABLE, &&L_SETLIST, &&L_SETLIST0,
+		&&L_SETLISTW, &&L_SETMAP, &&L_SETMAP0, &&L_EQOP,
+		&&L_NEQOP, &&L_LTOP, &&L_LEOP, &&L_GTOP,
+		&&L_GEOP, &&L_ADDOP, &&L_SUBOP, &&L_MULTOP,
+		&&L_DIVOP, &&L_POWOP, &&L_CONCOP, &&L_MINUSOP,
+		&&L_NOTOP, &&L_ONTJMP, &&L_ONTJMPW, &&L_ONFJMP,
+		&&L_ONFJMPW, &&L_JMP, &&L_JMPW, &&L_IFFJMP,
+		&&L_IFFJMPW, &&L_IFTUPJMP, &&L_IFTUPJMPW, &&L_IFFUPJMP,
+		&&L_IFFUPJMPW, &&L_CLOSURE, &&L_CLOSURE0, &&L_CLOSURE1,
+		&&L_CALLFUNC, &&L_CALLFUNC0, &&L_CALLFUNC1, &&L_RETCODE,
+		&&L_SETLINE, &&L_SETLINEW, &&L_POP, &&L_POP0,
+		&&L_POP1, &&L_PUSHLOCAL0_GETDOTTED, &&L_PUSHLOCAL1_GETDOTTED, &&L_PUSHLOCAL2_GETDOTTED,
+		&&L_PUSHLOCAL3_GETDOTTED, &&L_PUSHLOCAL4_GETDOTTED, &&L_PUSHLOCAL5_GETDOTTED, &&L_PUSHLOCAL6_GETDOTTED,
+		&&L_PUSHLOCAL7_GETDOTTED, &&L_GETGLOBAL0_GETDOTTED, &&L_GETGLOBAL1_GETDOTTED, &&L_GETGLOBAL2_GETDOTTED,
+		&&L_GETGLOBAL3_GETDOTTED, &&L_GETGLOBAL4_GETDOTTED, &&L_GETGLOBAL5_GETDOTTED, &&L_GETGLOBAL6_GETDOTTED,
+		&&L_GETGLOBAL7_GETDOTTED, &&L_PUSHLOCAL0_CALLFUNC, &&L_PUSHLOCAL1_CALLFUNC, &&L_PUSHLOCAL2_CALLFUNC,
+		&&L_PUSHLOCAL3_CALLFUNC, &&L_PUSHLOCAL4_CALLFUNC, &&L_PUSHLOCAL5_CALLFUNC, &&L_PUSHLOCAL6_CALLFUNC,
+		&&L_PUSHLOCAL7_CALLFUNC, &&L_GETGLOBAL0_CALLFUNC, &&L_GETGLOBAL1_CALLFUNC, &&L_GETGLOBAL2_CALLFUNC,
+		&&L_GETGLOBAL3_CALLFUNC, &&L_GETGLOBAL4_CALLFUNC, &&L_GETGLOBAL5_CALLFUNC, &&L_GETGLOBAL6_CALLFUNC,
+		&&L_GETGLOBAL7_CALLFUNC, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default,
+		&&L_default, &&L_default, &&L_default, &&L_default
+	};
+#endif
+
 	while (1) {
-		switch ((OpCode)(task->aux = *task->pc++)) {
-		case PUSHNIL0:
+		vmfetch();
+		vmdispatch(task->aux) {
+		vmcase(PUSHNIL0)
 			ttype(task->S->top++) = LUA_T_NIL;
-			break;
-		case PUSHNIL:
+			vmbreak;
+		vmcase(PUSHNIL)
 			task->aux = *task->pc++;
 			do {
 				ttype(task->S->top++) = LUA_T_NIL;
 			} while (task->aux--);
-			break;
-		case PUSHNUMBER:
+			vmbreak;
+		vmcase(PUSHNUMBER)
 			task->aux = *task->pc++;
 			goto pushnumber;
-		case PUSHNUMBERW:
+		vmcase(PUSHNUMBERW)
 			task->aux = next_word(task->pc);
 			goto pushnumber;
-		case PUSHNUMBER0:
-		case PUSHNUMBER1:
-		case PUSHNUMBER2:
+		vmcase(PUSHNUMBER0)
+		vmcase(PUSHNUMBER1)
+		vmcase(PUSHNUMBER2)
 			task->aux -= PUSHNUMBER0;
 pushnumber:
 			ttype(task->S->top) = LUA_T_NUMBER;
 			nvalue(task->S->top) = (float)task->aux;
 			task->S->top++;
-			break;
-		case PUSHLOCAL:
+			vmbreak;
+		vmcase(PUSHLOCAL)
 			task->aux = *task->pc++;
 			goto pushlocal;
-		case PUSHLOCAL0:
-		case PUSHLOCAL1:
-		case PUSHLOCAL2:
-		case PUSHLOCAL3:
-		case PUSHLOCAL4:
-		case PUSHLOCAL5:
-		case PUSHLOCAL6:
-		case PUSHLOCAL7:
+		vmcase(PUSHLOCAL0)
+		vmcase(PUSHLOCAL1)
+		vmcase(PUSHLOCAL2)
+		vmcase(PUSHLOCAL3)
+		vmcase(PUSHLOCAL4)
+		vmcase(PUSHLOCAL5)
+		vmcase(PUSHLOCAL6)
+		vmcase(PUSHLOCAL7)
 			task->aux -= PUSHLOCAL0;
 pushlocal:
 			*task->S->top++ = *((task->S->stack + task->base) + task->aux);
-			break;
-		case GETGLOBALW:
+			vmbreak;
+		vmcase(GETGLOBALW)
 			task->aux = next_word(task->pc);
 			goto getglobal;
-		case GETGLOBAL:
+		vmcase(GETGLOBAL)
 			task->aux = *task->pc++;
 			goto getglobal;
-		case GETGLOBAL0:
-		case GETGLOBAL1:
-		case GETGLOBAL2:
-		case GETGLOBAL3:
-		case GETGLOBAL4:
-		case GETGLOBAL5:
-		case GETGLOBAL6:
-		case GETGLOBAL7:
+		vmcase(GETGLOBAL0)
+		vmcase(GETGLOBAL1)
+		vmcase(GETGLOBAL2)
+		vmcase(GETGLOBAL3)
+		vmcase(GETGLOBAL4)
+		vmcase(GETGLOBAL5)
+		vmcase(GETGLOBAL6)
+		vmcase(GETGLOBAL7)
 			task->aux -= GETGLOBAL0;
 getglobal:
 			luaV_getglobal(tsvalue(&task->consts[task->aux]));
-			break;
-		case GETTABLE:
+			vmbreak;
+		vmcase(GETTABLE)
 			luaV_gettable();
-			break;
-		case GETDOTTEDW:
+			vmbreak;
+		vmcase(GETDOTTEDW)
 			task->aux = next_word(task->pc); goto getdotted;
-		case GETDOTTED:
+		vmcase(GETDOTTED)
 			task->aux = *task->pc++;
 			goto getdotted;
-		case GETDOTTED0:
-		case GETDOTTED1:
-		case GETDOTTED2:
-		case GETDOTTED3:
-		case GETDOTTED4:
-		case GETDOTTED5:
-		case GETDOTTED6:
-		case GETDOTTED7:
+		vmcase(GETDOTTED0)
+		vmcase(GETDOTTED1)
+		vmcase(GETDOTTED2)
+		vmcase(GETDOTTED3)
+		vmcase(GETDOTTED4)
+		vmcase(GETDOTTED5)
+		vmcase(GETDOTTED6)
+		vmcase(GETDOTTED7)
 			task->aux -= GETDOTTED0;
 getdotted:
 			*task->S->top++ = task->consts[task->aux];
 			luaV_gettable();
-			break;
-		case PUSHSELFW:
+			vmbreak;
+		vmcase(PUSHSELFW)
 			task->aux = next_word(task->pc);
 			goto pushself;
-		case PUSHSELF:
+		vmcase(PUSHSELF)
 			task->aux = *task->pc++;
 			goto pushself;
-		case PUSHSELF0:
-		case PUSHSELF1:
-		case PUSHSELF2:
-		case PUSHSELF3:
-		case PUSHSELF4:
-		case PUSHSELF5:
-		case PUSHSELF6:
-		case PUSHSELF7:
+		vmcase(PUSHSELF0)
+		vmcase(PUSHSELF1)
+		vmcase(PUSHSELF2)
+		vmcase(PUSHSELF3)
+		vmcase(PUSHSELF4)
+		vmcase(PUSHSELF5)
+		vmcase(PUSHSELF6)
+		vmcase(PUSHSELF7)
 			task->aux -= PUSHSELF0;
 pushself:
 			{
@@ -355,81 +539,81 @@ pushself:
 				*task->S->top++ = task->consts[task->aux];
 				luaV_gettable();
 				*task->S->top++ = receiver;
-				break;
+				vmbreak;
 			}
-		case PUSHCONSTANTW:
+		vmcase(PUSHCONSTANTW)
 			task->aux = next_word(task->pc);
 			goto pushconstant;
-		case PUSHCONSTANT:
+		vmcase(PUSHCONSTANT)
 			task->aux = *task->pc++; goto pushconstant;
-		case PUSHCONSTANT0:
-		case PUSHCONSTANT1:
-		case PUSHCONSTANT2:
-		case PUSHCONSTANT3:
-		case PUSHCONSTANT4:
-		case PUSHCONSTANT5:
-		case PUSHCONSTANT6:
-		case PUSHCONSTANT7:
+		vmcase(PUSHCONSTANT0)
+		vmcase(PUSHCONSTANT1)
+		vmcase(PUSHCONSTANT2)
+		vmcase(PUSHCONSTANT3)
+		vmcase(PUSHCONSTANT4)
+		vmcase(PUSHCONSTANT5)
+		vmcase(PUSHCONSTANT6)
+		vmcase(PUSHCONSTANT7)
 			task->aux -= PUSHCONSTANT0;
 pushconstant:
 			*task->S->top++ = task->consts[task->aux];
-			break;
-		case PUSHUPVALUE:
+			vmbreak;
+		vmcase(PUSHUPVALUE)
 			task->aux = *task->pc++;
 			goto pushupvalue;
-		case PUSHUPVALUE0:
-		case PUSHUPVALUE1:
+		vmcase(PUSHUPVALUE0)
+		vmcase(PUSHUPVALUE1)
 			task->aux -= PUSHUPVALUE0;
 pushupvalue:
 			*task->S->top++ = task->cl->consts[task->aux + 1];
-			break;
-		case SETLOCAL:
+			vmbreak;
+		vmcase(SETLOCAL)
 			task->aux = *task->pc++;
 			goto setlocal;
-		case SETLOCAL0:
-		case SETLOCAL1:
-		case SETLOCAL2:
-		case SETLOCAL3:
-		case SETLOCAL4:
-		case SETLOCAL5:
-		case SETLOCAL6:
-		case SETLOCAL7:
+		vmcase(SETLOCAL0)
+		vmcase(SETLOCAL1)
+		vmcase(SETLOCAL2)
+		vmcase(SETLOCAL3)
+		vmcase(SETLOCAL4)
+		vmcase(SETLOCAL5)
+		vmcase(SETLOCAL6)
+		vmcase(SETLOCAL7)
 			task->aux -= SETLOCAL0;
 setlocal:
 			*((task->S->stack + task->base) + task->aux) = *(--task->S->top);
-			break;
-		case SETGLOBALW:
+			vmbreak;
+		vmcase(SETGLOBALW)
 			task->aux = next_word(task->pc);
 			goto setglobal;
-		case SETGLOBAL:
+		vmcase(SETGLOBAL)
 			task->aux = *task->pc++;
 			goto setglobal;
-		case SETGLOBAL0:
-		case SETGLOBAL1:
-		case SETGLOBAL2:
-		case SETGLOBAL3:
-		case SETGLOBAL4:
-		case SETGLOBAL5:
-		case SETGLOBAL6:
-		case SETGLOBAL7:
+		vmcase(SETGLOBAL0)
+		vmcase(SETGLOBAL1)
+		vmcase(SETGLOBAL2)
+		vmcase(SETGLOBAL3)
+		vmcase(SETGLOBAL4)
+		vmcase(SETGLOBAL5)
+		vmcase(SETGLOBAL6)
+		vmcase(SETGLOBAL7)
 			task->aux -= SETGLOBAL0;
 setglobal:
 			luaV_setglobal(tsvalue(&task->consts[task->aux]));
-			break;
-		case SETTABLE0:
+			vmbreak;
+		vmcase(SETTABLE0)
 			luaV_settable(task->S->top - 3, 1);
-			break;
-		case SETTABLE:
+			vmbreak;
+		vmcase(SETTABLE)
 			luaV_settable(task->S->top - 3 - (*task->pc++), 2);
-			break;
-		case SETLISTW:
+			vmbreak;
+		vmcase(SETLISTW)
 			task->aux = next_word(task->pc);
 			task->aux *= LFIELDS_PER_FLUSH;
 			goto setlist;
-		case SETLIST:
+		vmcase(SETLIST)
 			task->aux = *(task->pc++) * LFIELDS_PER_FLUSH;
 			goto setlist;
-		case SETLIST0:
+		vmcase(SETLIST0)
 			task->aux = 0;
 setlist:
 			{
@@ -441,12 +625,12 @@ setlist:
 					*(luaH_set(avalue(arr), task->S->top)) = *(task->S->top - 1);
 					task->S->top--;
 			}
-			break;
+			vmbreak;
 		}
-		case SETMAP0:
+		vmcase(SETMAP0)
 			task->aux = 0;
 			goto setmap;
-		case SETMAP:
+		vmcase(SETMAP)
 			task->aux = *task->pc++;
 setmap:
 			{
@@ -455,34 +639,34 @@ setmap:
 					*(luaH_set(avalue(arr), task->S->top - 2)) = *(task->S->top - 1);
 					task->S->top -= 2;
 				} while (task->aux--);
-				break;
+				vmbreak;
 			}
-		case POP:
+		vmcase(POP)
 			task->aux = *task->pc++;
 			goto pop;
-		case POP0:
-		case POP1:
+		vmcase(POP0)
+		vmcase(POP1)
 			task->aux -= POP0;
 pop:
 			task->S->top -= (task->aux + 1);
-			break;
-		case CREATEARRAYW:
+			vmbreak;
+		vmcase(CREATEARRAYW)
 			task->aux = next_word(task->pc);
 			goto createarray;
-		case CREATEARRAY0:
-		case CREATEARRAY1:
+		vmcase(CREATEARRAY0)
+		vmcase(CREATEARRAY1)
 			task->aux -= CREATEARRAY0;
 			goto createarray;
-		case CREATEARRAY:
+		vmcase(CREATEARRAY)
 			task->aux = *task->pc++;
 createarray:
 			luaC_checkGC();
 			avalue(task->S->top) = luaH_new(task->aux);
 			ttype(task->S->top) = LUA_T_ARRAY;
 			task->S->top++;
-			break;
-		case EQOP:
-		case NEQOP:
+			vmbreak;
+		vmcase(EQOP)
+		vmcase(NEQOP)
 			{
 				int32 res = luaO_equalObj(task->S->top - 2, task->S->top - 1);
 				task->S->top--;
@@ -490,21 +674,21 @@ createarray:
 					res = !res;
 				ttype(task->S->top - 1) = res ? LUA_T_NUMBER : LUA_T_NIL;
 				nvalue(task->S->top - 1) = 1;
-				break;
+				vmbreak;
 			}
-		case LTOP:
+		vmcase(LTOP)
 			comparison(LUA_T_NUMBER, LUA_T_NIL, LUA_T_NIL, IM_LT);
-			break;
-		case LEOP:
+			vmbreak;
+		vmcase(LEOP)
 			comparison(LUA_T_NUMBER, LUA_T_NUMBER, LUA_T_NIL, IM_LE);
-			break;
-		case GTOP:
+			vmbreak;
+		vmcase(GTOP)
 			comparison(LUA_T_NIL, LUA_T_NIL, LUA_T_NUMBER, IM_GT);
-			break;
-		case GEOP:
+			vmbreak;
+		vmcase(GEOP)
 			comparison(LUA_T_NIL, LUA_T_NUMBER, LUA_T_NUMBER, IM_GE);
-			break;
-		case ADDOP:
+			vmbreak;
+		vmcase(ADDOP)
 			{
 				TObject *l = task->S->top - 2;
 				TObject *r = task->S->top - 1;
@@ -514,9 +698,9 @@ createarray:
 					nvalue(l) += nvalue(r);
 					--task->S->top;
 				}
-			break;
+			vmbreak;
 			}
-		case SUBOP:
+		vmcase(SUBOP)
 			{
 				TObject *l = task->S->top - 2;
 				TObject *r = task->S->top - 1;
@@ -526,9 +710,9 @@ createarray:
 					nvalue(l) -= nvalue(r);
 					--task->S->top;
 				}
-				break;
+				vmbreak;
 			}
-		case MULTOP:
+		vmcase(MULTOP)
 			{
 				TObject *l = task->S->top - 2;
 				TObject *r = task->S->top - 1;
@@ -538,9 +722,9 @@ createarray:
 					nvalue(l) *= nvalue(r);
 					--task->S->top;
 				}
-				break;
+				vmbreak;
 			}
-		case DIVOP:
+		vmcase(DIVOP)
 			{
 				TObject *l = task->S->top - 2;
 				TObject *r = task->S->top - 1;
@@ -550,12 +734,12 @@ createarray:
 					nvalue(l) /= nvalue(r);
 					--task->S->top;
 				}
-				break;
+				vmbreak;
 			}
-		case POWOP:
+		vmcase(POWOP)
 			call_arith(IM_POW);
-			break;
-		case CONCOP:
+			vmbreak;
+		vmcase(CONCOP)
 			{
 				TObject *l = task->S->top - 2;
 				TObject *r = task->S->top - 1;
@@ -566,106 +750,161 @@ createarray:
 					--task->S->top;
 				}
 				luaC_checkGC();
-				break;
+				vmbreak;
 			}
-		case MINUSOP:
+		vmcase(MINUSOP)
 			if (tonumber(task->S->top - 1)) {
 				ttype(task->S->top) = LUA_T_NIL;
 				task->S->top++;
 				call_arith(IM_UNM);
 			} else
 				nvalue(task->S->top - 1) = -nvalue(task->S->top - 1);
-			break;
-		case NOTOP:
+			vmbreak;
+		vmcase(NOTOP)
 			ttype(task->S->top - 1) = (ttype(task->S->top - 1) == LUA_T_NIL) ? LUA_T_NUMBER : LUA_T_NIL;
 			nvalue(task->S->top - 1) = 1;
-			break;
-		case ONTJMPW:
+			vmbreak;
+		vmcase(ONTJMPW)
 			task->aux = next_word(task->pc);
 			goto ontjmp;
-		case ONTJMP:
+		vmcase(ONTJMP)
 			task->aux = *task->pc++;
 ontjmp:
 			if (ttype(task->S->top - 1) != LUA_T_NIL)
 				task->pc += task->aux;
 			else
 				task->S->top--;
-			break;
-		case ONFJMPW:
+			vmbreak;
+		vmcase(ONFJMPW)
 			task->aux = next_word(task->pc);
 			goto onfjmp;
-		case ONFJMP:
+		vmcase(ONFJMP)
 			task->aux = *task->pc++;
 onfjmp:
 			if (ttype(task->S->top - 1) == LUA_T_NIL)
 				task->pc += task->aux;
 			else
 				task->S->top--;
-			break;
-		case JMPW:
+			vmbreak;
+		vmcase(JMPW)
 			task->aux = next_word(task->pc);
 			goto jmp;
-		case JMP:
+		vmcase(JMP)
 			task->aux = *task->pc++;
 jmp:
 			task->pc += task->aux;
-			break;
-		case IFFJMPW:
+			vmbreak;
+		vmcase(IFFJMPW)
 			task->aux = next_word(task->pc);
 			goto iffjmp;
-		case IFFJMP:
+		vmcase(IFFJMP)
 			task->aux = *task->pc++;
 iffjmp:
 			if (ttype(--task->S->top) == LUA_T_NIL)
 				task->pc += task->aux;
-			break;
-		case IFTUPJMPW:
+			vmbreak;
+		vmcase(IFTUPJMPW)
 			task->aux = next_word(task->pc);
 			goto iftupjmp;
-		case IFTUPJMP:
+		vmcase(IFTUPJMP)
 			task->aux = *task->pc++;
 iftupjmp:
 			if (ttype(--task->S->top) != LUA_T_NIL)
 				task->pc -= task->aux;
-			break;
-		case IFFUPJMPW:
+			vmbreak;
+		vmcase(IFFUPJMPW)
 			task->aux = next_word(task->pc);
 			goto iffupjmp;
-		case IFFUPJMP:
+		vmcase(IFFUPJMP)
 			task->aux = *task->pc++;
 iffupjmp:
 			if (ttype(--task->S->top) == LUA_T_NIL)
 				task->pc -= task->aux;
-			break;
-		case CLOSURE:
+			vmbreak;
+		vmcase(CLOSURE)
 			task->aux = *task->pc++;
 			goto closure;
-		case CLOSURE0:
-		case CLOSURE1:
+		vmcase(CLOSURE0)
+		vmcase(CLOSURE1)
 			task->aux -= CLOSURE0;
 closure:
 			luaV_closure(task->aux);
 			luaC_checkGC();
-			break;
-	  case CALLFUNC:
+			vmbreak;
+	  vmcase(CALLFUNC)
 			task->aux = *task->pc++;
 			goto callfunc;
-	  case CALLFUNC0:
-	  case CALLFUNC1:
+	  vmcase(CALLFUNC0)
+	  vmcase(CALLFUNC1)
 			task->aux -= CALLFUNC0;
 callfunc:
 			lua_state->state_counter2--;
 			return -((task->S->top - task->S->stack) - (*task->pc++));
-		case ENDCODE:
+		vmcase(PUSHLOCAL0_GETDOTTED)
+		vmcase(PUSHLOCAL1_GETDOTTED)
+		vmcase(PUSHLOCAL2_GETDOTTED)
+		vmcase(PUSHLOCAL3_GETDOTTED)
+		vmcase(PUSHLOCAL4_GETDOTTED)
+		vmcase(PUSHLOCAL5_GETDOTTED)
+		vmcase(PUSHLOCAL6_GETDOTTED)
+		vmcase(PUSHLOCAL7_GETDOTTED)
+			*task->S->top++ = *((task->S->stack + task->base) + (task->aux - PUSHLOCAL0_GETDOTTED));
+			goto fusedgetdotted;
+		vmcase(GETGLOBAL0_GETDOTTED)
+		vmcase(GETGLOBAL1_GETDOTTED)
+		vmcase(GETGLOBAL2_GETDOTTED)
+		vmcase(GETGLOBAL3_GETDOTTED)
+		vmcase(GETGLOBAL4_GETDOTTED)
+		vmcase(GETGLOBAL5_GETDOTTED)
+		vmcase(GETGLOBAL6_GETDOTTED)
+		vmcase(GETGLOBAL7_GETDOTTED)
+			luaV_getglobal(tsvalue(&task->consts[task->aux - GETGLOBAL0_GETDOTTED]));
+fusedgetdotted:
+			task->aux = *task->pc++;
+			if (task->aux == GETDOTTEDW)
+				task->aux = next_word(task->pc);
+			else if (task->aux == GETDOTTED)
+				task->aux = *task->pc++;
+			else
+				task->aux -= GETDOTTED0;
+			goto getdotted;
+		vmcase(PUSHLOCAL0_CALLFUNC)
+		vmcase(PUSHLOCAL1_CALLFUNC)
+		vmcase(PUSHLOCAL2_CALLFUNC)
+		vmcase(PUSHLOCAL3_CALLFUNC)
+		vmcase(PUSHLOCAL4_CALLFUNC)
+		vmcase(PUSHLOCAL5_CALLFUNC)
+		vmcase(PUSHLOCAL6_CALLFUNC)
+		vmcase(PUSHLOCAL7_CALLFUNC)
+			*task->S->top++ = *((task->S->stack + task->base) + (task->aux - PUSHLOCAL0_CALLFUNC));
+			goto fusedcallfunc;
+		vmcase(GETGLOBAL0_CALLFUNC)
+		vmcase(GETGLOBAL1_CALLFUNC)
+		vmcase(GETGLOBAL2_CALLFUNC)
+		vmcase(GETGLOBAL3_CALLFUNC)
+		vmcase(GETGLOBAL4_CALLFUNC)
+		vmcase(GETGLOBAL5_CALLFUNC)
+		vmcase(GETGLOBAL6_CALLFUNC)
+		vmcase(GETGLOBAL7_CALLFUNC)
+			luaV_getglobal(tsvalue(&task->consts[task->aux - GETGLOBAL0_CALLFUNC]));
+fusedcallfunc:
+			task->aux = *task->pc++;
+			if (task->aux == CALLFUNC)
+				task->aux = *task->pc++;
+			else
+				task->aux -= CALLFUNC0;
+			goto callfunc;
+		vmcase(ENDCODE)
 			task->S->top = task->S->stack + task->base;
-			// fall through
-		case RETCODE:
+			goto retcode;
+		vmcase(RETCODE)
+retcode:
 			lua_state->state_counter2--;
 			return (task->base + ((task->aux == 123) ? *task->pc : 0));
-		case SETLINEW:
+		vmcase(SETLINEW)
 			task->aux = next_word(task->pc);
 			goto setline;
-		case SETLINE:
+		vmcase(SETLINE)
 			task->aux = *task->pc++;
 setline:
 			if ((task->S->stack + task->base - 1)->ttype != LUA_T_LINE) {
@@ -677,13 +916,18 @@ setline:
 			(task->S->stack + task->base - 1)->value.i = task->aux;
 			if (lua_linehook)
 				luaD_lineHook(task->aux);
-			break;
+			vmbreak;
+		vmdefault
 #ifdef LUA_DEBUG
-		default:
 			LUA_INTERNALERROR("internal error - opcode doesn't match");
 #endif
+			vmbreak;
 		}
 	}
 }
 
+#if defined(LUA_USE_COMPUTED_GOTO) && defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 } // end of namespace Grim
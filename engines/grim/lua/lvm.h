@@ -9,6 +9,8 @@
 
 #include "engines/grim/lua/ldo.h"
 #include "engines/grim/lua/lobject.h"
+#include "engines/grim/lua/lopcodes.h"
+#include "engines/grim/lua/lopstats.h"
 
 namespace Grim {
 
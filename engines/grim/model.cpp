@@ -24,6 +24,7 @@
 #include "common/endian.h"
 #include "common/func.h"
 
+#include "engines/grim/benchmark.h"
 #include "engines/grim/debug.h"
 #include "engines/grim/grim.h"
 #include "engines/grim/model.h"
@@ -578,10 +579,14 @@ void Mesh::getBoundingBox(int *x1, int *y1, int *x2, int *y2) const {
 /**
  * @class ModelNode
  */
+uint32 ModelNode::_lastGeneration = 0;
+
 ModelNode::ModelNode() :
 		_initialized(false), _needsUpdate(true), _mesh(nullptr), _flags(0), _type(0),
 		_depth(0), _numChildren(0), _parent(nullptr), _child(nullptr), _sprite(nullptr),
-		_sibling(nullptr), _meshVisible(false), _hierVisible(false) {
+		_sibling(nullptr), _meshVisible(false), _hierVisible(false),
+		_poseGeneration(0), _parentGeneration(0), _worldGeneration(0),
+		_worldPoseGeneration(0), _worldParentGeneration(0) {
 	_name[0] = '\0';
 }
 
@@ -725,9 +730,14 @@ void ModelNode::removeChild(ModelNode *child) {
 }
 
 void ModelNode::setMatrix(const Math::Matrix4 &matrix) {
+	setParentTransform(matrix, 0);
+}
+
+void ModelNode::setParentTransform(const Math::Matrix4 &matrix, uint32 generation) {
 	_matrix = matrix;
+	_parentGeneration = generation;
 	if (_sibling)
-		_sibling->setMatrix(matrix);
+		_sibling->setParentTransform(matrix, generation);
 }
 
 void ModelNode::update() {
@@ -735,10 +745,25 @@ void ModelNode::update() {
 		return;
 
 	if (_hierVisible && _needsUpdate) {
-		_localMatrix = _animRot.toMatrix();
-		_localMatrix.setPosition(_animPos);
+		updatePoseMatrices();
+		_localMatrix = _cachedLocalMatrix;
+
+		// _matrix holds the parent transform here, see setParentTransform()
+		bool parentChanged;
+		if (_parentGeneration != 0) {
+			parentChanged = _parentGeneration != _worldParentGeneration;
+		} else {
+			parentChanged = _worldParentGeneration != 0 || _matrix != _cachedParentMatrix;
+		}
 
-		_matrix = _matrix * _localMatrix;
+		if (_worldGeneration == 0 || _worldPoseGeneration != _poseGeneration || parentChanged) {
+			_cachedParentMatrix = _matrix;
+			_cachedWorldMatrix = _matrix * _localMatrix;
+			_worldPoseGeneration = _poseGeneration;
+			_worldParentGeneration = _parentGeneration;
+			_worldGeneration = ++_lastGeneration;
+		}
+		_matrix = _cachedWorldMatrix;
 
 		_pivotMatrix = _matrix;
 		_pivotMatrix.translate(_pivot);
@@ -748,7 +773,7 @@ void ModelNode::update() {
 		}
 
 		if (_child) {
-			_child->setMatrix(_matrix);
+			_child->setParentTransform(_matrix, _worldGeneration);
 			_child->update();
 		}
 
@@ -780,12 +805,33 @@ void ModelNode::removeSprite(const Sprite *sprite) {
 	}
 }
 
+void ModelNode::updatePoseMatrices() const {
+	Benchmark *benchmark = g_grim->getBenchmark();
+
+	// Compare the raw values, the quaternion comparison operator has a tolerance
+	if (_poseGeneration != 0 && _cachedAnimPos == _animPos &&
+			memcmp(_cachedAnimRot.getData(), _animRot.getData(), 4 * sizeof(float)) == 0) {
+		if (benchmark)
+			benchmark->addToCounter(Benchmark::kCounterNodesCached);
+		return;
+	}
+
+	_cachedAnimPos = _animPos;
+	_cachedAnimRot = _animRot;
+	_cachedLocalMatrix = _animRot.toMatrix();
+	_cachedViewpointRot = _cachedLocalMatrix;
+	_cachedViewpointRot.transpose();
+	_cachedLocalMatrix.setPosition(_animPos);
+	_poseGeneration = ++_lastGeneration;
+	if (benchmark)
+		benchmark->addToCounter(Benchmark::kCounterNodesRecomputed);
+}
+
 void ModelNode::translateViewpoint() const {
-	g_driver->translateViewpoint(_animPos);
+	updatePoseMatrices();
 
-	Math::Matrix4 rot = _animRot.toMatrix();
-	rot.transpose();
-	g_driver->rotateViewpoint(rot);
+	g_driver->translateViewpoint(_animPos);
+	g_driver->rotateViewpoint(_cachedViewpointRot);
 }
 
 void ModelNode::translateViewpointStart() const {
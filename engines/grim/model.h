@@ -202,6 +202,37 @@ public:
 	Math::Matrix4 _localMatrix;
 	Math::Matrix4 _pivotMatrix;
 	Sprite *_sprite;
+
+private:
+	void updatePoseMatrices() const;
+	void setParentTransform(const Math::Matrix4 &matrix, uint32 generation);
+
+	// Each rebuilt transform gets a new generation number from this counter.
+	// Generation 0 means that a transform has not been built yet.
+	static uint32 _lastGeneration;
+
+	// The transforms derived from the animated pose are cached, and only
+	// rebuilt when _animPos or _animRot differ from the pose they were built
+	// from. Most nodes keep the same pose for many frames, idle actors and
+	// static props don't animate at all. Costume components reset the pose
+	// every frame before reapplying the keyframes, so the pose is compared
+	// when it is used rather than flagged when it is written.
+	mutable uint32 _poseGeneration;
+	mutable Math::Vector3d _cachedAnimPos;
+	mutable Math::Quaternion _cachedAnimRot;
+	mutable Math::Matrix4 _cachedLocalMatrix;
+	mutable Math::Matrix4 _cachedViewpointRot;
+	// The world transform is rebuilt by update() when the local pose or the
+	// parent transform changed. The generations tell which parent transform
+	// was given to setParentTransform(). The parent node gives its own
+	// generation, a transform set from outside the hierarchy has none and
+	// is compared with the one the world transform was built from.
+	uint32 _parentGeneration;
+	uint32 _worldGeneration;
+	uint32 _worldPoseGeneration;
+	uint32 _worldParentGeneration;
+	Math::Matrix4 _cachedParentMatrix;
+	Math::Matrix4 _cachedWorldMatrix;
 };
 
 } // end of namespace Grim
@@ -89,6 +89,7 @@ MODULE_OBJS := \
 	update/update.o \
 	actor.o \
 	animation.o \
+	benchmark.o \
 	bitmap.o \
 	costume.o \
 	color.o \
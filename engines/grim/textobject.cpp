@@ -44,6 +44,8 @@ void TextObjectCommon::setLayer(int layer) {
 		g_grim->invalidateTextObjectsSortOrder();
 }
 
+Common::HashMap<Common::String, TextObject::Layout> *TextObject::_layouts = nullptr;
+
 TextObject::TextObject() :
 		TextObjectCommon(), _numberLines(1), _textID(""), _elapsedTime(0),
 		_maxLineWidth(0), _lines(nullptr), _userData(nullptr), _created(false),
@@ -171,7 +173,6 @@ void TextObject::destroy() {
 
 void TextObject::setupText() {
 	Common::String msg = LuaBase::instance()->parseMsgText(_textID.c_str(), nullptr);
-	Common::String message;
 
 	// remove spaces (NULL_TEXT) from the end of the string,
 	// while this helps make the string unique it screws up
@@ -215,40 +216,7 @@ void TextObject::setupText() {
 		maxWidth = _x;
 	}
 
-	// We break the message to lines not longer than maxWidth
-	Common::String currLine;
-	_numberLines = 1;
-	int lineWidth = 0;
-	for (uint i = 0; i < msg.size(); i++) {
-		message += msg[i];
-		currLine += msg[i];
-		lineWidth += _font->getCharKernedWidth(msg[i]);
-
-		if (currLine.size() > 1 && lineWidth > maxWidth) {
-			if (currLine.contains(' ')) {
-				while (currLine.lastChar() != ' ' && currLine.size() > 1) {
-					lineWidth -= _font->getCharKernedWidth(currLine.lastChar());
-					message.deleteLastChar();
-					currLine.deleteLastChar();
-					--i;
-				}
-			} else { // if it is a unique word
-				int dashWidth = _font->getCharKernedWidth('-');
-				while (lineWidth + dashWidth > maxWidth && currLine.size() > 1) {
-					lineWidth -= _font->getCharKernedWidth(currLine.lastChar());
-					message.deleteLastChar();
-					currLine.deleteLastChar();
-					--i;
-				}
-				message += '-';
-			}
-			message += '\n';
-			currLine.clear();
-			_numberLines++;
-
-			lineWidth = 0;
-		}
-	}
+	layoutText(msg, maxWidth);
 
 	// If the text object is a speech subtitle, the y parameter is the
 	// coordinate of the bottom of the text block (instead of the top). It means
@@ -262,27 +230,92 @@ void TextObject::setupText() {
 		}
 	}
 
-	_lines = new Common::String[_numberLines];
+	_elapsedTime = 0;
+}
 
-	for (int j = 0; j < _numberLines; j++) {
-		int nextLinePos, cutLen;
-		const char *breakPos = strchr(message.c_str(), '\n');
-		if (breakPos) {
-			nextLinePos = breakPos - message.c_str();
-			cutLen = nextLinePos + 1;
-		} else {
-			nextLinePos = message.size();
-			cutLen = nextLinePos;
+void TextObject::layoutText(const Common::String &msg, int maxWidth) {
+	// Dialogue menus and subtitles set up the same strings over and over,
+	// so the line breaking is only done once per font and width.
+	Common::String key = Common::String::format("%p:%d:", (const void *)_font, maxWidth) + msg;
+	if (!_layouts) {
+		_layouts = new Common::HashMap<Common::String, Layout>();
+	}
+
+	Common::HashMap<Common::String, Layout>::const_iterator it = _layouts->find(key);
+	if (it == _layouts->end()) {
+		// Keep the cache bounded, scripts can generate an unlimited amount of strings
+		if (_layouts->size() >= 512) {
+			_layouts->clear();
 		}
-		Common::String currentLine(message.c_str(), message.c_str() + nextLinePos);
-		_lines[j] = currentLine;
-		int width = _font->getKernedStringLength(currentLine);
-		if (width > _maxLineWidth)
-			_maxLineWidth = width;
-		for (int count = 0; count < cutLen; count++)
-			message.deleteChar(0);
+
+		Layout layout;
+		layout._maxLineWidth = 0;
+
+		// We break the message to lines not longer than maxWidth
+		Common::String message;
+		Common::String currLine;
+		int numberLines = 1;
+		int lineWidth = 0;
+		for (uint i = 0; i < msg.size(); i++) {
+			message += msg[i];
+			currLine += msg[i];
+			lineWidth += _font->getCharKernedWidth(msg[i]);
+
+			if (currLine.size() > 1 && lineWidth > maxWidth) {
+				if (currLine.contains(' ')) {
+					while (currLine.lastChar() != ' ' && currLine.size() > 1) {
+						lineWidth -= _font->getCharKernedWidth(currLine.lastChar());
+						message.deleteLastChar();
+						currLine.deleteLastChar();
+						--i;
+					}
+				} else { // if it is a unique word
+					int dashWidth = _font->getCharKernedWidth('-');
+					while (lineWidth + dashWidth > maxWidth && currLine.size() > 1) {
+						lineWidth -= _font->getCharKernedWidth(currLine.lastChar());
+						message.deleteLastChar();
+						currLine.deleteLastChar();
+						--i;
+					}
+					message += '-';
+				}
+				message += '\n';
+				currLine.clear();
+				numberLines++;
+
+				lineWidth = 0;
+			}
+		}
+
+		const char *lineStart = message.c_str();
+		for (int j = 0; j < numberLines; j++) {
+			const char *breakPos = strchr(lineStart, '\n');
+			const char *lineEnd = breakPos ? breakPos : lineStart + strlen(lineStart);
+			Common::String currentLine(lineStart, lineEnd);
+			int width = _font->getKernedStringLength(currentLine);
+			if (width > layout._maxLineWidth)
+				layout._maxLineWidth = width;
+			layout._lines.push_back(currentLine);
+			lineStart = breakPos ? breakPos + 1 : lineEnd;
+		}
+
+		_layouts->setVal(key, layout);
+		it = _layouts->find(key);
 	}
-	_elapsedTime = 0;
+
+	const Layout &layout = it->_value;
+	_numberLines = layout._lines.size();
+	_lines = new Common::String[_numberLines];
+	for (int j = 0; j < _numberLines; j++) {
+		_lines[j] = layout._lines[j];
+	}
+	if (layout._maxLineWidth > _maxLineWidth)
+		_maxLineWidth = layout._maxLineWidth;
+}
+
+void TextObject::clearLayoutCache() {
+	delete _layouts;
+	_layouts = nullptr;
 }
 
 int TextObject::getLineX(int line) const {
@@ -26,7 +26,9 @@
 #include "engines/grim/pool.h"
 #include "engines/grim/color.h"
 
+#include "common/array.h"
 #include "common/endian.h"
+#include "common/hashmap.h"
 
 namespace Grim {
 
@@ -120,6 +122,8 @@ public:
 	void incStackLevel() { _stackLevel++; }
 	void decStackLevel() { assert(_stackLevel > 0); _stackLevel--; }
 
+	static void clearLayoutCache();
+
 	enum Justify {
 		NONE,
 		CENTER,
@@ -129,6 +133,7 @@ public:
 
 protected:
 	void setupText();
+	void layoutText(const Common::String &msg, int maxWidth);
 
 	Common::String _textID;
 
@@ -145,6 +150,13 @@ protected:
 	bool _created;
 
 	int _stackLevel;
+
+	// Line breaking results, keyed by font, maximum line width and message
+	struct Layout {
+		Common::Array<Common::String> _lines;
+		int _maxLineWidth;
+	};
+	static Common::HashMap<Common::String, Layout> *_layouts;
 };
 
 } // end of namespace Grim
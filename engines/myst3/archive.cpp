@@ -117,6 +117,15 @@ void Archive::readDirectory() {
 	while (directory.pos() + 4 < directory.size()) {
 		_directory.push_back(readEntry(directory));
 	}
+
+	for (uint i = 0; i < _directory.size(); i++) {
+		DirectoryKey key(_directory[i].roomName, _directory[i].index);
+
+		// Keep the first entry, like the former linear search did
+		if (!_directoryIndex.contains(key)) {
+			_directoryIndex.setVal(key, i);
+		}
+	}
 }
 
 void Archive::visit(ArchiveVisitor &visitor) {
@@ -143,14 +152,12 @@ uint32 Archive::copyTo(uint32 offset, uint32 size, Common::WriteStream &out) {
 }
 
 const Archive::DirectoryEntry *Archive::getEntry(const Common::String &room, uint32 index) const {
-	for (uint i = 0; i < _directory.size(); i++) {
-		const DirectoryEntry &entry = _directory[i];
-		if (entry.index == index && entry.roomName == room) {
-			return &entry;
-		}
+	DirectoryIndex::const_iterator it = _directoryIndex.find(DirectoryKey(room, index));
+	if (it == _directoryIndex.end()) {
+		return nullptr;
 	}
 
-	return nullptr;
+	return &_directory[it->_value];
 }
 
 ResourceDescription Archive::getDescription(const Common::String &room, uint32 index, uint16 face,
@@ -207,6 +214,7 @@ void Archive::close() {
 	_directorySize = 0;
 	_roomName.clear();
 	_directory.clear();
+	_directoryIndex.clear();
 	_file.close();
 }
 
@@ -25,6 +25,8 @@
 
 #include "common/array.h"
 #include "common/file.h"
+#include "common/hash-str.h"
+#include "common/hashmap.h"
 
 #include "math/vector3d.h"
 
@@ -96,6 +98,25 @@ private:
 	uint32 _directorySize;
 	Common::Array<DirectoryEntry> _directory;
 
+	struct DirectoryKey {
+		Common::String roomName;
+		uint32 index;
+
+		DirectoryKey(const Common::String &r, uint32 i) : roomName(r), index(i) {}
+	};
+
+	struct DirectoryKey_Hash {
+		uint operator()(const DirectoryKey &x) const { return Common::hashit(x.roomName) ^ (x.index * 2654435761u); }
+	};
+
+	struct DirectoryKey_EqualTo {
+		bool operator()(const DirectoryKey &x, const DirectoryKey &y) const { return x.index == y.index && x.roomName == y.roomName; }
+	};
+
+	/** Position in the directory of the entries, by room and index */
+	typedef Common::HashMap<DirectoryKey, uint, DirectoryKey_Hash, DirectoryKey_EqualTo> DirectoryIndex;
+	DirectoryIndex _directoryIndex;
+
 	void decryptHeader(Common::SeekableReadStream &inStream, Common::WriteStream &outStream);
 	void readDirectory();
 	DirectorySubEntry readSubEntry(Common::ReadStream &stream);
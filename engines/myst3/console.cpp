@@ -44,6 +44,8 @@ Console::Console(Myst3Engine *vm) : GUI::Debugger(), _vm(vm) {
 	registerCmd("fillInventory",			WRAP_METHOD(Console, Cmd_FillInventory));
 	registerCmd("dumpArchive",			WRAP_METHOD(Console, Cmd_DumpArchive));
 	registerCmd("dumpMasks",			WRAP_METHOD(Console, Cmd_DumpMasks));
+	registerCmd("benchVars",			WRAP_METHOD(Console, Cmd_BenchVars));
+	registerCmd("dbTimings",			WRAP_METHOD(Console, Cmd_DatabaseTimings));
 }
 
 Console::~Console() {
@@ -455,6 +457,73 @@ bool Console::Cmd_DumpMasks(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::Cmd_BenchVars(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Usage :\n");
+		debugPrintf("benchVars [frames] : Time the engine variable accesses made during a frame\n");
+		return true;
+	}
+
+	uint32 frames = 100000;
+	if (argc == 2)
+		frames = atoi(argv[1]);
+
+	GameState *state = _vm->_state;
+	int32 checksum = 0;
+
+	uint32 start = g_system->getMillis(true);
+
+	for (uint32 i = 0; i < frames; i++) {
+		// Roughly the engine variables read each frame while idling in a cube node
+		checksum += state->getCursorTransparency();
+		checksum += state->getCursorLocked();
+		checksum += state->getCursorHidden();
+		checksum += state->getCameraPitch();
+		checksum += state->getCameraHeading();
+		checksum += state->getCameraMinPitch();
+		checksum += state->getCameraMaxPitch();
+		checksum += state->getLocationAge();
+		checksum += state->getLocationRoom();
+		checksum += state->getLocationNode();
+		checksum += state->getTickCountdown();
+		checksum += state->getSweepEnabled();
+		checksum += state->getWaterEffectRunning();
+		checksum += state->getWaterEffectActive();
+		checksum += state->getWaterEffectAmpl();
+		checksum += state->getWaterEffectSpeed();
+
+		if (state->hasVarGamePadUpPressed())
+			checksum += state->getGamePadUpPressed();
+
+		state->setTickCountdown(state->getTickCountdown());
+	}
+
+	uint32 elapsed = g_system->getMillis(true) - start;
+	uint32 accesses = frames * (state->hasVarGamePadUpPressed() ? 20 : 19);
+
+	debugPrintf("%d frames, %d engine var accesses in %d ms (checksum %d)\n", frames, accesses, elapsed, checksum);
+	if (elapsed)
+		debugPrintf("%d accesses per ms\n", accesses / elapsed);
+
+	return true;
+}
+
+bool Console::Cmd_DatabaseTimings(int argc, const char **argv) {
+	if (argc != 1) {
+		debugPrintf("Usage :\n");
+		debugPrintf("dbTimings : Display the time spent loading the room scripts\n");
+		return true;
+	}
+
+	Database *db = _vm->_db;
+
+	debugPrintf("Database loaded at startup in %d ms\n", db->getStartupTime());
+	debugPrintf("Last room scripts loaded in %d ms\n", db->getLastRoomLoadTime());
+	debugPrintf("%d room loads, %d from the cache\n", db->getRoomLoadCount(), db->getRoomCacheHitCount());
+
+	return true;
+}
+
 bool Console::dumpFaceMask(uint16 index, int face, Archive::ResourceType type) {
 	ResourceDescription maskDesc = _vm->getFileDescription("", index, face, type);
 
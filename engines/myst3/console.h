@@ -57,6 +57,8 @@ private:
 	bool Cmd_DumpArchive(int argc, const char **argv);
 	bool Cmd_DumpMasks(int argc, const char **argv);
 	bool Cmd_FillInventory(int argc, const char **argv);
+	bool Cmd_BenchVars(int argc, const char **argv);
+	bool Cmd_DatabaseTimings(int argc, const char **argv);
 };
 
 } // End of namespace Myst3
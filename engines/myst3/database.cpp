@@ -21,10 +21,11 @@
  */
 
 #include "engines/myst3/database.h"
+#include "engines/myst3/myst3.h"
 
 #include "common/archive.h"
 #include "common/debug.h"
-#include "common/substream.h"
+#include "common/system.h"
 
 namespace Myst3 {
 
@@ -150,6 +151,7 @@ Common::Array<Opcode> ScriptData::readOpcodes(Common::ReadStream &s) {
 		if (count == 0 && opcode.op == 0)
 			break;
 
+		opcode.args.reserve(count);
 		for (int i = 0; i < count; i++) {
 			int16 value = s.readSint16LE();
 			opcode.args.push_back(value);
@@ -457,7 +459,13 @@ Database::Database(const Common::Platform platform, const Common::Language langu
 		_language(language),
 		_localizationType(localizationType),
 		_soundIdMin(0),
-		_soundIdMax(0) {
+		_soundIdMax(0),
+		_startupTime(0),
+		_lastRoomLoadTime(0),
+		_roomLoadCount(0),
+		_roomCacheHitCount(0) {
+
+	uint32 startTime = g_system->getMillis(true);
 
 	_datFile = SearchMan.createReadStreamForMember("myst3.dat");
 	if (!_datFile) {
@@ -503,6 +511,9 @@ Database::Database(const Common::Platform platform, const Common::Language langu
 	if (isWindowMacVersion && _localizationType == kLocMulti2) {
 		patchLanguageMenu();
 	}
+
+	_startupTime = g_system->getMillis(true) - startTime;
+	debugC(kDebugNode, "Loaded the Myst 3 database in %d ms", _startupTime);
 }
 
 Database::~Database() {
@@ -569,8 +580,9 @@ void Database::initializeZipBitIndexTable() {
 
 			// Add the highest zip-bit index for the current room
 			// to get the zip-bit index for the next room
+			// The common rooms are already in the cache
 			int16 maxZipBitForRoom = 0;
-			Common::Array<NodePtr> nodes = readRoomScripts(&_ages[i].rooms[j]);
+			Common::Array<NodePtr> nodes = getRoomNodes(_ages[i].rooms[j].id, _ages[i].id);
 			for (uint k = 0; k < nodes.size(); k++) {
 				maxZipBitForRoom = MAX(maxZipBitForRoom, nodes[k]->zipBitIndex);
 			}
@@ -693,15 +705,25 @@ bool Database::isCommonRoom(uint32 roomID, uint32 ageID) const {
 }
 
 void Database::cacheRoom(uint32 roomID, uint32 ageID) {
-	if (_roomNodesCache.contains(RoomKey(roomID, ageID))) {
+	RoomKey key = RoomKey(roomID, ageID);
+
+	_roomLoadCount++;
+
+	if (_roomNodesCache.contains(key)) {
+		_roomCacheHitCount++;
+
+		// Mark the room as the most recently used one
+		if (!isCommonRoom(roomID, ageID)) {
+			_cachedRooms.remove(key);
+			_cachedRooms.push_back(key);
+		}
 		return;
 	}
 
-	// Remove old rooms from cache and add the new one
-	for (NodesCache::iterator it = _roomNodesCache.begin(); it != _roomNodesCache.end(); it++) {
-		if (!isCommonRoom(it->_key.roomID, it->_key.ageID)) {
-			_roomNodesCache.erase(it);
-		}
+	// Remove the least recently used rooms from the cache and add the new one
+	while (_cachedRooms.size() >= kMaxCachedRooms) {
+		_roomNodesCache.erase(_cachedRooms.front());
+		_cachedRooms.pop_front();
 	}
 
 	const RoomData *currentRoomData = findRoomData(roomID, ageID);
@@ -709,7 +731,13 @@ void Database::cacheRoom(uint32 roomID, uint32 ageID) {
 	if (!currentRoomData)
 		return;
 
-	_roomNodesCache.setVal(RoomKey(roomID, ageID), readRoomScripts(currentRoomData));
+	uint32 startTime = g_system->getMillis(true);
+
+	_roomNodesCache.setVal(key, readRoomScripts(currentRoomData));
+	_cachedRooms.push_back(key);
+
+	_lastRoomLoadTime = g_system->getMillis(true) - startTime;
+	debugC(kDebugNode, "Loaded the scripts for room %s in %d ms", currentRoomData->name, _lastRoomLoadTime);
 }
 
 Common::String Database::getRoomName(uint32 roomID, uint32 ageID) const {
@@ -830,7 +858,9 @@ Common::SeekableReadStream *Database::getRoomScriptStream(const char *room, Scri
 			uint32 startOffset = _roomScriptsStartOffset + _roomScriptsIndex[i].offset;
 			uint32 size = _roomScriptsIndex[i].size;
 
-			return new Common::SeekableSubReadStream(_datFile, startOffset, startOffset + size);
+			// Read the scripts in memory at once, they are parsed using lots of small reads
+			_datFile->seek(startOffset);
+			return _datFile->readStream(size);
 		}
 	}
 
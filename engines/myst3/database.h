@@ -32,6 +32,7 @@
 #include "common/ptr.h"
 #include "common/array.h"
 #include "common/hashmap.h"
+#include "common/list.h"
 #include "common/stream.h"
 
 namespace Myst3 {
@@ -236,6 +237,16 @@ public:
 	/** Check if the scripts for two rooms are identical */
 	bool areRoomsScriptsEqual(uint32 roomID1, uint32 ageID1, uint32 roomID2, uint32 ageID2, ScriptType scriptType);
 
+	/** Get the time spent loading the database at startup, in milliseconds */
+	uint32 getStartupTime() const { return _startupTime; }
+
+	/** Get the time spent loading the scripts of the last room not found in the cache, in milliseconds */
+	uint32 getLastRoomLoadTime() const { return _lastRoomLoadTime; }
+
+	/** Get the number of room script loads, and how many of them were served from the cache */
+	uint32 getRoomLoadCount() const { return _roomLoadCount; }
+	uint32 getRoomCacheHitCount() const { return _roomCacheHitCount; }
+
 private:
 	struct RoomKeyHash {
 		uint operator()(const RoomKey &v) const {
@@ -253,6 +264,11 @@ private:
 
 	NodesCache _roomNodesCache;
 
+	// Recently visited rooms are kept in the cache, so going back
+	// and forth between rooms does not parse their scripts again
+	static const uint kMaxCachedRooms = 4;
+	Common::List<RoomKey> _cachedRooms; // Non common cached rooms, most recently used last
+
 	Common::Array<Opcode> _nodeInitScript;
 
 	uint32 _soundIdMin;
@@ -261,6 +277,11 @@ private:
 	Common::HashMap<uint16, AmbientCue> _ambientCues;
 	Common::HashMap<uint32, int16> _roomZipBitIndex;
 
+	uint32 _startupTime;
+	uint32 _lastRoomLoadTime;
+	uint32 _roomLoadCount;
+	uint32 _roomCacheHitCount;
+
 	// 'myst3.dat' cached data
 	static const uint kDatVersion = 3;
 	Common::SeekableReadStream *_datFile;
@@ -55,6 +55,53 @@ Common::Rect Effect::FaceMask::getBlockRect(uint x, uint y) {
 	return rect;
 }
 
+void Effect::FaceMask::flipBlocksVertical() {
+	for (uint i = 0; i < 10; i++) {
+		for (uint j = 0; j < 5; j++) {
+			SWAP(block[i][j], block[i][9 - j]);
+		}
+	}
+
+	updateActiveRects();
+}
+
+void Effect::FaceMask::updateActiveRects() {
+	_activeRects.clear();
+
+	for (uint j = 0; j < 10; j++) {
+		uint i = 0;
+		while (i < 10) {
+			if (!block[i][j]) {
+				i++;
+				continue;
+			}
+
+			// Merge the consecutive active blocks of the row
+			Common::Rect rect = getBlockRect(i, j);
+			while (i < 10 && block[i][j]) {
+				rect.extend(getBlockRect(i, j));
+				i++;
+			}
+
+			_activeRects.push_back(rect);
+		}
+	}
+}
+
+void Effect::FaceMask::getActiveRects(uint16 width, uint16 height, Common::Array<Common::Rect> &rects) const {
+	rects.clear();
+
+	Common::Rect bounds = Common::Rect(width, height);
+	for (uint i = 0; i < _activeRects.size(); i++) {
+		Common::Rect rect = _activeRects[i];
+		rect.clip(bounds);
+
+		if (!rect.isEmpty()) {
+			rects.push_back(rect);
+		}
+	}
+}
+
 Effect::Effect(Myst3Engine *vm) :
 		_vm(vm) {
 }
@@ -82,6 +129,7 @@ bool Effect::loadMasks(const Common::String &room, uint32 id, Archive::ResourceT
 			// Frame masks are vertically flipped for some reason
 			if (isFrame) {
 				_vm->_gfx->flipVertical(_facesMasks[i]->surface);
+				_facesMasks[i]->flipBlocksVertical();
 			}
 
 			delete data;
@@ -133,6 +181,8 @@ Effect::FaceMask *Effect::loadMask(Common::SeekableReadStream *maskStream) {
 		}
 	}
 
+	mask->updateActiveRects();
+
 	return mask;
 }
 
@@ -144,15 +194,11 @@ Common::Rect Effect::getUpdateRectForFace(uint face) {
 	Common::Rect rect;
 
 	// Build a rectangle containing all the active effect blocks
-	for (uint i = 0; i < 10; i++) {
-		for (uint j = 0; j < 10; j++) {
-			if (mask->block[i][j]) {
-				if (rect.isEmpty()) {
-					rect = FaceMask::getBlockRect(i, j);
-				} else {
-					rect.extend(FaceMask::getBlockRect(i, j));
-				}
-			}
+	for (uint i = 0; i < mask->_activeRects.size(); i++) {
+		if (rect.isEmpty()) {
+			rect = mask->_activeRects[i];
+		} else {
+			rect.extend(mask->_activeRects[i]);
 		}
 	}
 
@@ -261,10 +307,10 @@ void WaterEffect::applyForFace(uint face, Graphics::Surface *src, Graphics::Surf
 	if (!mask)
 		error("No mask for face %d", face);
 
-	apply(src, dst, mask->surface, face == 1, _vm->_state->getWaterEffectAmpl());
+	apply(src, dst, mask, face == 1, _vm->_state->getWaterEffectAmpl());
 }
 
-void WaterEffect::apply(Graphics::Surface *src, Graphics::Surface *dst, Graphics::Surface *mask, bool bottomFace, int32 waterEffectAmpl) {
+void WaterEffect::apply(Graphics::Surface *src, Graphics::Surface *dst, FaceMask *mask, bool bottomFace, int32 waterEffectAmpl) {
 	int32 waterEffectAttenuation = _vm->_state->getWaterEffectAttenuation();
 	int32 waterEffectAmplOffset = _vm->_state->getWaterEffectAmplOffset();
 
@@ -278,58 +324,67 @@ void WaterEffect::apply(Graphics::Surface *src, Graphics::Surface *dst, Graphics
 		vDisplacement = _verticalDisplacement;
 	}
 
-	uint32 *dstPtr = (uint32 *)dst->getPixels();
-	byte *maskPtr = (byte *)mask->getPixels();
-
-	for (uint y = 0; y < dst->h; y++) {
-		if (!bottomFace) {
-			uint32 strength = (320 * (9 - y / 64)) / waterEffectAttenuation;
-			if (strength > 4)
-				strength = 4;
-			hDisplacement = _horizontalDisplacements[strength];
-		}
+	// Only the active blocks of the mask have non zero values
+	Common::Array<Common::Rect> rects;
+	mask->getActiveRects(dst->w, dst->h, rects);
 
-		for (uint x = 0; x < dst->w; x++) {
-			int8 maskValue = *maskPtr;
+	for (uint i = 0; i < rects.size(); i++) {
+		const Common::Rect &rect = rects[i];
 
-			if (maskValue != 0) {
-				int8 xOffset = hDisplacement[x];
-				int8 yOffset = vDisplacement[y];
+		for (uint y = rect.top; y < (uint)rect.bottom; y++) {
+			if (!bottomFace) {
+				uint32 strength = (320 * (9 - y / 64)) / waterEffectAttenuation;
+				if (strength > 4)
+					strength = 4;
+				hDisplacement = _horizontalDisplacements[strength];
+			}
 
-				if (maskValue < 8) {
-					maskValue -= waterEffectAmplOffset;
-					if (maskValue < 0) {
-						maskValue = 0;
+			uint32 *dstPtr = (uint32 *)dst->getBasePtr(rect.left, y);
+			const byte *maskPtr = (const byte *)mask->surface->getBasePtr(rect.left, y);
+			const uint32 *srcRow = (const uint32 *)src->getBasePtr(0, y);
+
+			for (uint x = rect.left; x < (uint)rect.right; x++) {
+				int8 maskValue = *maskPtr;
+
+				if (maskValue != 0) {
+					int8 xOffset = hDisplacement[x];
+					int8 yOffset = vDisplacement[y];
+
+					if (maskValue < 8) {
+						maskValue -= waterEffectAmplOffset;
+						if (maskValue < 0) {
+							maskValue = 0;
+						}
+
+						if (xOffset >= 0) {
+							if (xOffset > maskValue)
+								xOffset = maskValue;
+						} else {
+							if (-xOffset > maskValue)
+								xOffset = -maskValue;
+						}
+						if (yOffset >= 0) {
+							if (yOffset > maskValue)
+								yOffset = maskValue;
+						} else {
+							if (-yOffset > maskValue)
+								yOffset = -maskValue;
+						}
 					}
 
-					if (xOffset >= 0) {
-						if (xOffset > maskValue)
-							xOffset = maskValue;
-					} else {
-						if (-xOffset > maskValue)
-							xOffset = -maskValue;
-					}
-					if (yOffset >= 0) {
-						if (yOffset > maskValue)
-							yOffset = maskValue;
-					} else {
-						if (-yOffset > maskValue)
-							yOffset = -maskValue;
-					}
-				}
-
-				uint32 srcValue1 = *(uint32 *) src->getBasePtr(x + xOffset, y + yOffset);
-				uint32 srcValue2 = *(uint32 *) src->getBasePtr(x, y);
+					uint32 srcValue1 = *(const uint32 *) src->getBasePtr(x + xOffset, y + yOffset);
+					uint32 srcValue2 = srcRow[x];
 
 #ifdef SCUMM_BIG_ENDIAN
-				*dstPtr = 0x000000FF | ((0x7F7F7F00 & (srcValue1 >> 1)) + (0x7F7F7F00 & (srcValue2 >> 1)));
+					*dstPtr = 0x000000FF | ((0x7F7F7F00 & (srcValue1 >> 1)) + (0x7F7F7F00 & (srcValue2 >> 1)));
 #else
-				*dstPtr = 0xFF000000 | ((0x007F7F7F & (srcValue1 >> 1)) + (0x007F7F7F & (srcValue2 >> 1)));
+					*dstPtr = 0xFF000000 | ((0x007F7F7F & (srcValue1 >> 1)) + (0x007F7F7F & (srcValue2 >> 1)));
 #endif
-			}
+				}
 
-			maskPtr++;
-			dstPtr++;
+				maskPtr++;
+				dstPtr++;
+			}
 		}
 	}
 }
@@ -392,37 +447,44 @@ void LavaEffect::applyForFace(uint face, Graphics::Surface *src, Graphics::Surfa
 	if (!mask)
 		error("No mask for face %d", face);
 
-	uint32 *dstPtr = (uint32 *)dst->getPixels();
-	byte *maskPtr = (byte *)mask->surface->getPixels();
+	Common::Array<Common::Rect> rects;
+	mask->getActiveRects(dst->w, dst->h, rects);
 
-	for (uint y = 0; y < dst->h; y++) {
-		for (uint x = 0; x < dst->w; x++) {
-			uint8 maskValue = *maskPtr;
+	for (uint i = 0; i < rects.size(); i++) {
+		const Common::Rect &rect = rects[i];
 
-			if (maskValue != 0) {
-				int32 xOffset= _displacement[(maskValue + y) % 256];
-				int32 yOffset = _displacement[maskValue % 256];
-				int32 maxOffset = (maskValue >> 6) & 0x3;
+		for (uint y = rect.top; y < (uint)rect.bottom; y++) {
+			uint32 *dstPtr = (uint32 *)dst->getBasePtr(rect.left, y);
+			const byte *maskPtr = (const byte *)mask->surface->getBasePtr(rect.left, y);
 
-				if (yOffset > maxOffset) {
-					yOffset = maxOffset;
-				}
-				if (xOffset > maxOffset) {
-					xOffset = maxOffset;
-				}
+			for (uint x = rect.left; x < (uint)rect.right; x++) {
+				uint8 maskValue = *maskPtr;
+
+				if (maskValue != 0) {
+					int32 xOffset= _displacement[(maskValue + y) % 256];
+					int32 yOffset = _displacement[maskValue % 256];
+					int32 maxOffset = (maskValue >> 6) & 0x3;
+
+					if (yOffset > maxOffset) {
+						yOffset = maxOffset;
+					}
+					if (xOffset > maxOffset) {
+						xOffset = maxOffset;
+					}
 
-//				uint32 srcValue1 = *(uint32 *)src->getBasePtr(x + xOffset, y + yOffset);
-//				uint32 srcValue2 = *(uint32 *)src->getBasePtr(x, y);
+//					uint32 srcValue1 = *(uint32 *)src->getBasePtr(x + xOffset, y + yOffset);
+//					uint32 srcValue2 = *(uint32 *)src->getBasePtr(x, y);
 //
-//				*dstPtr = 0xFF000000 | ((0x007F7F7F & (srcValue1 >> 1)) + (0x007F7F7F & (srcValue2 >> 1)));
+//					*dstPtr = 0xFF000000 | ((0x007F7F7F & (srcValue1 >> 1)) + (0x007F7F7F & (srcValue2 >> 1)));
 
-				// TODO: The original does "blending" as above, but strangely
-				// this looks more like the original rendering
-				*dstPtr = *(uint32 *)src->getBasePtr(x + xOffset, y + yOffset);
-			}
+					// TODO: The original does "blending" as above, but strangely
+					// this looks more like the original rendering
+					*dstPtr = *(const uint32 *)src->getBasePtr(x + xOffset, y + yOffset);
+				}
 
-			maskPtr++;
-			dstPtr++;
+				maskPtr++;
+				dstPtr++;
+			}
 		}
 	}
 }
@@ -517,33 +579,41 @@ void MagnetEffect::applyForFace(uint face, Graphics::Surface *src, Graphics::Sur
 	if (!mask)
 		error("No mask for face %d", face);
 
-	apply(src, dst, mask->surface, _position * 256.0);
+	apply(src, dst, mask, _position * 256.0);
 }
 
-void MagnetEffect::apply(Graphics::Surface *src, Graphics::Surface *dst, Graphics::Surface *mask, int32 position) {
-	uint32 *dstPtr = (uint32 *)dst->getPixels();
-	byte *maskPtr = (byte *)mask->getPixels();
+void MagnetEffect::apply(Graphics::Surface *src, Graphics::Surface *dst, FaceMask *mask, int32 position) {
+	Common::Array<Common::Rect> rects;
+	mask->getActiveRects(dst->w, dst->h, rects);
 
-	for (uint y = 0; y < dst->h; y++) {
-		for (uint x = 0; x < dst->w; x++) {
-			uint8 maskValue = *maskPtr;
+	for (uint i = 0; i < rects.size(); i++) {
+		const Common::Rect &rect = rects[i];
 
-			if (maskValue != 0) {
-				int32 displacement = _verticalDisplacement[(maskValue + position) % 256];
-				int32 displacedY = CLIP<int32>(y + displacement, 0, src->h - 1);
+		for (uint y = rect.top; y < (uint)rect.bottom; y++) {
+			uint32 *dstPtr = (uint32 *)dst->getBasePtr(rect.left, y);
+			const byte *maskPtr = (const byte *)mask->surface->getBasePtr(rect.left, y);
+			const uint32 *srcRow = (const uint32 *)src->getBasePtr(0, y);
 
-				uint32 srcValue1 = *(uint32 *) src->getBasePtr(x, displacedY);
-				uint32 srcValue2 = *(uint32 *) src->getBasePtr(x, y);
+			for (uint x = rect.left; x < (uint)rect.right; x++) {
+				uint8 maskValue = *maskPtr;
+
+				if (maskValue != 0) {
+					int32 displacement = _verticalDisplacement[(maskValue + position) % 256];
+					int32 displacedY = CLIP<int32>(y + displacement, 0, src->h - 1);
+
+					uint32 srcValue1 = *(const uint32 *) src->getBasePtr(x, displacedY);
+					uint32 srcValue2 = srcRow[x];
 
 #ifdef SCUMM_BIG_ENDIAN
-				*dstPtr = 0x000000FF | ((0x7F7F7F00 & (srcValue1 >> 1)) + (0x7F7F7F00 & (srcValue2 >> 1)));
+					*dstPtr = 0x000000FF | ((0x7F7F7F00 & (srcValue1 >> 1)) + (0x7F7F7F00 & (srcValue2 >> 1)));
 #else
-				*dstPtr = 0xFF000000 | ((0x007F7F7F & (srcValue1 >> 1)) + (0x007F7F7F & (srcValue2 >> 1)));
+					*dstPtr = 0xFF000000 | ((0x007F7F7F & (srcValue1 >> 1)) + (0x007F7F7F & (srcValue2 >> 1)));
 #endif
-			}
+				}
 
-			maskPtr++;
-			dstPtr++;
+				maskPtr++;
+				dstPtr++;
+			}
 		}
 	}
 }
@@ -775,25 +845,33 @@ void ShieldEffect::applyForFace(uint face, Graphics::Surface *src, Graphics::Sur
 	if (!mask)
 		error("No mask for face %d", face);
 
-	uint32 *dstPtr = (uint32 *)dst->getPixels();
-	byte *maskPtr = (byte *)mask->surface->getPixels();
+	Common::Array<Common::Rect> rects;
+	mask->getActiveRects(dst->w, dst->h, rects);
+
+	for (uint i = 0; i < rects.size(); i++) {
+		const Common::Rect &rect = rects[i];
+
+		for (uint y = rect.top; y < (uint)rect.bottom; y++) {
+			uint32 *dstPtr = (uint32 *)dst->getBasePtr(rect.left, y);
+			const byte *maskPtr = (const byte *)mask->surface->getBasePtr(rect.left, y);
+			const uint8 *patternRow = &_pattern[(y % 64) * 64];
 
-	for (uint y = 0; y < dst->h; y++) {
-		for (uint x = 0; x < dst->w; x++) {
-			uint8 maskValue = *maskPtr;
+			for (uint x = rect.left; x < (uint)rect.right; x++) {
+				uint8 maskValue = *maskPtr;
 
-			if (maskValue != 0) {
-				int32 yOffset = _displacement[_pattern[(y % 64) * 64 + (x % 64)]];
+				if (maskValue != 0) {
+					int32 yOffset = _displacement[patternRow[x % 64]];
 
-				if (yOffset > maskValue) {
-					yOffset = maskValue;
+					if (yOffset > maskValue) {
+						yOffset = maskValue;
+					}
+
+					*dstPtr = *(const uint32 *)src->getBasePtr(x, y + yOffset);
 				}
 
-				*dstPtr = *(uint32 *)src->getBasePtr(x, y + yOffset);
+				maskPtr++;
+				dstPtr++;
 			}
-
-			maskPtr++;
-			dstPtr++;
 		}
 	}
 }
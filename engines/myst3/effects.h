@@ -23,6 +23,7 @@
 #ifndef EFFECTS_H_
 #define EFFECTS_H_
 
+#include "common/array.h"
 #include "common/hashmap.h"
 #include "common/rect.h"
 
@@ -44,8 +45,22 @@ public:
 
 		static Common::Rect getBlockRect(uint x, uint y);
 
+		/** Flip the active blocks to match a vertically flipped surface */
+		void flipBlocksVertical();
+
+		/** Get the areas covered by the active blocks, clipped to a surface size */
+		void getActiveRects(uint16 width, uint16 height, Common::Array<Common::Rect> &rects) const;
+
 		Graphics::Surface *surface;
 		bool block[10][10];
+
+	private:
+		void updateActiveRects();
+
+		// Horizontal runs of active blocks, built after loading
+		Common::Array<Common::Rect> _activeRects;
+
+		friend class Effect;
 	};
 
 	virtual ~Effect();
@@ -82,7 +97,7 @@ protected:
 	WaterEffect(Myst3Engine *vm);
 
 	void doStep(float position, bool isFrame);
-	void apply(Graphics::Surface *src, Graphics::Surface *dst, Graphics::Surface *mask,
+	void apply(Graphics::Surface *src, Graphics::Surface *dst, FaceMask *mask,
 			bool bottomFace, int32 waterEffectAmpl);
 
 	uint32 _lastUpdate;
@@ -126,7 +141,7 @@ public:
 protected:
 	MagnetEffect(Myst3Engine *vm);
 
-	void apply(Graphics::Surface *src, Graphics::Surface *dst, Graphics::Surface *mask, int32 position);
+	void apply(Graphics::Surface *src, Graphics::Surface *dst, FaceMask *mask, int32 position);
 
 	int32 _lastSoundId;
 	Common::SeekableReadStream *_shakeStrength;
@@ -0,0 +1,158 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/myst3/facecache.h"
+#include "engines/myst3/archive.h"
+#include "engines/myst3/database.h"
+#include "engines/myst3/myst3.h"
+#include "engines/myst3/state.h"
+
+#include "common/debug.h"
+
+namespace Myst3 {
+
+FaceCache::FaceCache(Myst3Engine *vm) :
+		_vm(vm),
+		_size(0),
+		_hits(0),
+		_misses(0) {
+}
+
+FaceCache::~FaceCache() {
+	clear();
+}
+
+void FaceCache::clear() {
+	_entries.clear();
+	_pending.clear();
+	_size = 0;
+}
+
+Common::String FaceCache::getCurrentRoomName() const {
+	return _vm->_db->getRoomName(_vm->_state->getLocationRoom(), _vm->_state->getLocationAge());
+}
+
+FaceCache::EntryList::iterator FaceCache::find(const FaceKey &key) {
+	for (EntryList::iterator it = _entries.begin(); it != _entries.end(); it++) {
+		if (it->key == key) {
+			return it;
+		}
+	}
+
+	return _entries.end();
+}
+
+FaceCache::SurfacePtr FaceCache::decode(const FaceKey &key) {
+	ResourceDescription jpegDesc = _vm->getFileDescription(key.room, key.node, key.face, Archive::kCubeFace);
+	if (!jpegDesc.isValid()) {
+		return SurfacePtr();
+	}
+
+	return SurfacePtr(Myst3Engine::decodeJpeg(&jpegDesc), Graphics::SurfaceDeleter());
+}
+
+void FaceCache::insert(const FaceKey &key, const SurfacePtr &bitmap) {
+	Entry entry;
+	entry.key = key;
+	entry.bitmap = bitmap;
+
+	_entries.push_front(entry);
+	_size += bitmap->pitch * bitmap->h;
+
+	// Evict the least recently used faces until we fit the budget again,
+	// always keeping the face that was just inserted. The faces still used
+	// by the current node are freed along with it.
+	while (_size > kMemoryBudget && _entries.size() > 1) {
+		const SurfacePtr &evicted = _entries.back().bitmap;
+		_size -= evicted->pitch * evicted->h;
+		_entries.pop_back();
+	}
+}
+
+Common::SharedPtr<Graphics::Surface> FaceCache::getCubeFace(uint16 node, uint16 face) {
+	FaceKey key(getCurrentRoomName(), node, face);
+
+	EntryList::iterator it = find(key);
+	if (it != _entries.end()) {
+		_hits++;
+
+		// Move the entry to the front of the list
+		Entry entry = *it;
+		_entries.erase(it);
+		_entries.push_front(entry);
+
+		return entry.bitmap;
+	}
+
+	_misses++;
+
+	SurfacePtr bitmap = decode(key);
+	if (!bitmap)
+		error("Face %d does not exist", node);
+
+	insert(key, bitmap);
+
+	return bitmap;
+}
+
+void FaceCache::prefetchNodes(const Common::Array<uint16> &nodes) {
+	_pending.clear();
+
+	debugC(kDebugNode, "Face cache: %d hits, %d misses, %d KB used", _hits, _misses, _size / 1024);
+
+	Common::String room = getCurrentRoomName();
+
+	uint count = MIN<uint>(nodes.size(), kMaxPrefetchedNodes);
+	for (uint i = 0; i < count; i++) {
+		// Queue the faces in reverse order, they are popped from the back
+		for (uint16 face = 6; face >= 1; face--) {
+			FaceKey key(room, nodes[count - i - 1], face);
+
+			if (find(key) == _entries.end()) {
+				_pending.push_back(key);
+			}
+		}
+	}
+}
+
+void FaceCache::prefetchStep() {
+	while (!_pending.empty()) {
+		FaceKey key = _pending.back();
+		_pending.pop_back();
+
+		// The face may have been loaded since it was queued
+		if (find(key) != _entries.end()) {
+			continue;
+		}
+
+		SurfacePtr bitmap = decode(key);
+		if (!bitmap) {
+			// Not a cube node
+			continue;
+		}
+
+		insert(key, bitmap);
+		return;
+	}
+}
+
+} // End of namespace Myst3
@@ -0,0 +1,122 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef MYST3_FACECACHE_H
+#define MYST3_FACECACHE_H
+
+#include "common/array.h"
+#include "common/list.h"
+#include "common/ptr.h"
+#include "common/str.h"
+
+#include "graphics/surface.h"
+
+namespace Myst3 {
+
+class Myst3Engine;
+
+/**
+ * Cache of decoded cube node faces
+ *
+ * Decoding the six JPEG faces is most of the time spent loading a cube node.
+ * The faces of recently loaded nodes are kept within a memory budget. While
+ * no movie is playing and no node change is pending, the faces of the nodes
+ * reachable from the current node are decoded ahead of time, one face per frame.
+ *
+ * The faces are shared between the cache and the nodes using them, so
+ * neither loading a face from the cache nor inserting it makes a copy.
+ */
+class FaceCache {
+public:
+	FaceCache(Myst3Engine *vm);
+	~FaceCache();
+
+	/**
+	 * Get a face of a cube node from the current room
+	 *
+	 * The face is decoded if it is not in the cache. The returned surface
+	 * is shared with the cache and must not be modified, callers needing
+	 * to draw on it have to make their own copy.
+	 */
+	Common::SharedPtr<Graphics::Surface> getCubeFace(uint16 node, uint16 face);
+
+	/**
+	 * Replace the list of nodes from the current room to decode ahead of time
+	 */
+	void prefetchNodes(const Common::Array<uint16> &nodes);
+
+	/**
+	 * Decode one of the faces waiting to be prefetched, if any
+	 *
+	 * Decoding a face takes a noticeable part of a frame. This is meant to
+	 * be called once per frame while the engine is idle.
+	 */
+	void prefetchStep();
+
+	void clear();
+
+private:
+	struct FaceKey {
+		Common::String room;
+		uint16 node;
+		uint16 face;
+
+		FaceKey() : node(0), face(0) {}
+		FaceKey(const Common::String &r, uint16 n, uint16 f) : room(r), node(n), face(f) {}
+
+		bool operator==(const FaceKey &other) const {
+			return node == other.node && face == other.face && room == other.room;
+		}
+	};
+
+	typedef Common::SharedPtr<Graphics::Surface> SurfacePtr;
+
+	struct Entry {
+		FaceKey key;
+		SurfacePtr bitmap;
+	};
+
+	typedef Common::List<Entry> EntryList;
+
+	static const uint32 kMemoryBudget = 64 * 1024 * 1024;
+	static const uint kMaxPrefetchedNodes = 3;
+
+	Myst3Engine *_vm;
+
+	// Most recently used entries first
+	EntryList _entries;
+	uint32 _size;
+
+	Common::Array<FaceKey> _pending;
+
+	uint _hits;
+	uint _misses;
+
+	Common::String getCurrentRoomName() const;
+	EntryList::iterator find(const FaceKey &key);
+	SurfacePtr decode(const FaceKey &key);
+	void insert(const FaceKey &key, const SurfacePtr &bitmap);
+};
+
+} // End of namespace Myst3
+
+#endif
@@ -140,6 +140,9 @@ void OpenGLTexture::copyFromFramebuffer(const Common::Rect &screen) {
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
+	// The copy does not leave the GPU. Drawing the screen to an offscreen framebuffer
+	// instead would only save this one copy per screenshot, and would need to restore
+	// the framebuffer the backend may itself be rendering the game to.
 	glCopyTexImage2D(GL_TEXTURE_2D, 0, internalFormat, screen.left, screen.top, internalWidth, internalHeight, 0);
 }
 
@@ -248,6 +248,18 @@ void TinyGLRenderer::drawFace(uint face, Texture *texture) {
 }
 
 void TinyGLRenderer::drawCube(Texture **textures) {
+	if (kDrawCubeAsPanorama) {
+		// The view is always from the cube center, sample the faces directly for each
+		// pixel instead of clipping and rasterizing the faces as textured triangles
+		TGLuint faceTextures[6];
+		for (uint i = 0; i < 6; i++) {
+			faceTextures[i] = static_cast<TinyGLTexture *>(textures[i])->id;
+		}
+
+		tglDrawPanorama(faceTextures, cubeVertices);
+		return;
+	}
+
 	tglEnable(TGL_TEXTURE_2D);
 	tglDepthMask(TGL_FALSE);
 
@@ -295,6 +307,15 @@ Graphics::Surface *TinyGLRenderer::getScreenshot() {
 	return s;
 }
 
+Texture *TinyGLRenderer::copyScreenshotToTexture() {
+	// The screenshot textures are only drawn using blits,
+	// build them straight from the frame buffer without an intermediate copy.
+	Graphics::Surface frameBuffer;
+	frameBuffer.init(kOriginalWidth, kOriginalHeight, _fb->linesize, _fb->getPixelBuffer(), _fb->cmode);
+
+	return new TinyGLTexture(&frameBuffer, true);
+}
+
 void TinyGLRenderer::flipBuffer() {
 	TinyGL::tglPresentBuffer();
 }
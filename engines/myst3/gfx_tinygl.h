@@ -56,9 +56,13 @@ public:
 	virtual void draw2DText(const Common::String &text, const Common::Point &position) override;
 
 	virtual Graphics::Surface *getScreenshot() override;
+	Texture *copyScreenshotToTexture() override;
 
 	virtual void flipBuffer() override;
 private:
+	// Draw the cube using the TinyGL panorama rasterizer rather than textured triangles
+	static const bool kDrawCubeAsPanorama = true;
+
 	void drawFace(uint face, Texture *texture);
 
 	TinyGL::FrameBuffer *_fb;
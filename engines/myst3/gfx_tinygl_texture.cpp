@@ -25,7 +25,7 @@
 
 namespace Myst3 {
 
-TinyGLTexture::TinyGLTexture(const Graphics::Surface *surface) {
+TinyGLTexture::TinyGLTexture(const Graphics::Surface *surface, bool blitOnly) {
 	width = surface->w;
 	height = surface->h;
 	format = surface->format;
@@ -39,6 +39,15 @@ TinyGLTexture::TinyGLTexture(const Graphics::Surface *surface) {
 	} else
 		error("Unknown pixel format");
 
+	_blitImage = Graphics::tglGenBlitImage();
+
+	if (blitOnly) {
+		// Only usable with the 2D drawing functions, skip resampling to a 3D texture
+		id = 0;
+		Graphics::tglUploadBlitImage(_blitImage, *surface, 0, false);
+		return;
+	}
+
 	tglGenTextures(1, &id);
 	tglBindTexture(TGL_TEXTURE_2D, id);
 	tglTexImage2D(TGL_TEXTURE_2D, 0, 3, width, height, 0, internalFormat, sourceFormat, 0);
@@ -48,26 +57,74 @@ TinyGLTexture::TinyGLTexture(const Graphics::Surface *surface) {
 	// NOTE: TinyGL doesn't have issues with white lines so doesn't need use TGL_CLAMP_TO_EDGE
 	tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_WRAP_S, TGL_REPEAT);
 	tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_WRAP_T, TGL_REPEAT);
-	_blitImage = Graphics::tglGenBlitImage();
 
 	update(surface);
 }
 
 TinyGLTexture::~TinyGLTexture() {
-	tglDeleteTextures(1, &id);
+	if (id)
+		tglDeleteTextures(1, &id);
 	tglDeleteBlitImage(_blitImage);
 }
 
 void TinyGLTexture::update(const Graphics::Surface *surface) {
+	if (!id) {
+		Graphics::tglUploadBlitImage(_blitImage, *surface, 0, false);
+		return;
+	}
+
+	if (format.bytesPerPixel != 4) {
+		tglBindTexture(TGL_TEXTURE_2D, id);
+		tglTexImage2D(TGL_TEXTURE_2D, 0, 3, width, height, 0,
+				internalFormat, sourceFormat, const_cast<void *>(surface->getPixels())); // TESTME: Not sure if it works.
+		Graphics::tglUploadBlitImage(_blitImage, *surface, 0, false);
+		return;
+	}
+
+	// Overwrite the existing texture and blit image storage rather than reallocating
+	// them, movies update their textures every frame
+	Common::Rect rect = Common::Rect(width, height);
+	updateTexture(surface, rect);
+	Graphics::tglUpdateBlitImage(_blitImage, *surface, rect, 0, false);
+}
+
+void TinyGLTexture::updateTexture(const Graphics::Surface *surface, const Common::Rect &rect) {
+	assert(surface->format == format);
+
 	tglBindTexture(TGL_TEXTURE_2D, id);
-	tglTexImage2D(TGL_TEXTURE_2D, 0, 3, width, height, 0,
-			internalFormat, sourceFormat, const_cast<void *>(surface->getPixels())); // TESTME: Not sure if it works.
-	Graphics::tglUploadBlitImage(_blitImage, *surface, 0, false);
+
+	if (rect.width() == surface->w && surface->pitch == surface->w * format.bytesPerPixel) {
+		tglTexSubImage2D(TGL_TEXTURE_2D, 0, rect.left, rect.top, rect.width(), rect.height(),
+				internalFormat, sourceFormat, const_cast<void *>(surface->getBasePtr(0, rect.top)));
+	} else {
+		// The pixels of the rectangle need to be contiguous
+		Graphics::Surface subSurface;
+		subSurface.create(rect.width(), rect.height(), format);
+		subSurface.copyRectToSurface(*surface, 0, 0, rect);
+
+		tglTexSubImage2D(TGL_TEXTURE_2D, 0, rect.left, rect.top, rect.width(), rect.height(),
+				internalFormat, sourceFormat, subSurface.getPixels());
+
+		subSurface.free();
+	}
 }
 
 void TinyGLTexture::updatePartial(const Graphics::Surface *surface, const Common::Rect &rect) {
-	// FIXME: TinyGL does not support partial texture update
-	update(surface);
+	if (!id || format.bytesPerPixel != 4) {
+		update(surface);
+		return;
+	}
+
+	// TinyGL resamples the textures to its own texture size. Include the neighbouring
+	// pixels so that all the texels interpolated from the updated area are refreshed.
+	Common::Rect updateRect = rect;
+	updateRect.grow(1);
+	updateRect.clip(Common::Rect(width, height));
+	if (updateRect.isEmpty())
+		return;
+
+	updateTexture(surface, updateRect);
+	Graphics::tglUpdateBlitImage(_blitImage, *surface, rect, 0, false);
 }
 
 Graphics::BlitImage *TinyGLTexture::getBlitTexture() const {
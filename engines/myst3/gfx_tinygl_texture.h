@@ -34,7 +34,7 @@ namespace Myst3 {
 
 class TinyGLTexture : public Texture {
 public:
-	TinyGLTexture(const Graphics::Surface *surface);
+	TinyGLTexture(const Graphics::Surface *surface, bool blitOnly = false);
 	virtual ~TinyGLTexture();
 
 	Graphics::BlitImage *getBlitTexture() const;
@@ -46,6 +46,8 @@ public:
 	TGLuint internalFormat;
 	TGLuint sourceFormat;
 private:
+	void updateTexture(const Graphics::Surface *surface, const Common::Rect &rect);
+
 	Graphics::BlitImage *_blitImage;
 };
 
@@ -38,6 +38,7 @@
 #include "engines/myst3/console.h"
 #include "engines/myst3/database.h"
 #include "engines/myst3/effects.h"
+#include "engines/myst3/facecache.h"
 #include "engines/myst3/myst3.h"
 #include "engines/myst3/nodecube.h"
 #include "engines/myst3/nodeframe.h"
@@ -67,7 +68,7 @@ Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 		_db(0), _console(0), _scriptEngine(0),
 		_state(0), _node(0), _scene(0), _archiveNode(0),
 		_cursor(0), _inventory(0), _gfx(0), _menu(0),
-		_rnd(0), _sound(0), _ambient(0),
+		_rnd(0), _sound(0), _ambient(0), _faceCache(0),
 		_inputSpacePressed(false), _inputEnterPressed(false),
 		_inputEscapePressed(false), _inputTildePressed(false),
 		_inputEscapePressedNotConsumed(false),
@@ -120,6 +121,7 @@ Myst3Engine::~Myst3Engine() {
 	delete _cursor;
 	delete _scene;
 	delete _archiveNode;
+	delete _faceCache;
 	delete _db;
 	delete _scriptEngine;
 	delete _console;
@@ -170,6 +172,7 @@ Common::Error Myst3Engine::run() {
 		_menu = new PagingMenu(this);
 	}
 	_archiveNode = new Archive();
+	_faceCache = new FaceCache(this);
 
 	_system->showMouse(false);
 
@@ -214,6 +217,12 @@ Common::Error Myst3Engine::run() {
 		}
 
 		drawFrame();
+
+		// Use the idle time to decode the faces of the nodes the player is likely to go to next.
+		// Decoding a face while a movie plays or a node is about to load would delay them.
+		if (_movies.empty() && !_state->getLocationNextNode()) {
+			_faceCache->prefetchStep();
+		}
 	}
 
 	tryAutoSaving(); //Attempt to autosave before exiting
@@ -879,6 +888,9 @@ void Myst3Engine::loadNode(uint16 nodeID, uint32 roomID, uint32 ageID) {
 		return; // The main init script does not load a node
 	}
 
+	if (_state->getViewType() == kCube)
+		prefetchNodeNeighbours();
+
 	// The effects can only be created after running the node init scripts
 	_node->initEffects();
 	_shakeEffect = ShakeEffect::create(this);
@@ -945,6 +957,27 @@ void Myst3Engine::runNodeInitScripts() {
 			_state->getLocationAge());
 }
 
+void Myst3Engine::prefetchNodeNeighbours() {
+	NodePtr nodeData = _db->getNodeData(
+			_state->getLocationNode(),
+			_state->getLocationRoom(),
+			_state->getLocationAge());
+
+	if (!nodeData)
+		return;
+
+	Common::Array<uint16> destinations;
+	for (uint i = 0; i < nodeData->hotspots.size(); i++) {
+		// Skip the background scripts
+		if (nodeData->hotspots[i].condition == -1)
+			continue;
+
+		_scriptEngine->listNodeDestinations(nodeData->hotspots[i].script, destinations);
+	}
+
+	_faceCache->prefetchNodes(destinations);
+}
+
 void Myst3Engine::runNodeBackgroundScripts() {
 	NodePtr nodeDataRoom = _db->getNodeData(32765, _state->getLocationRoom(), _state->getLocationAge());
 
@@ -80,6 +80,7 @@ class ShakeEffect;
 class RotationEffect;
 class Transition;
 class FrameLimiter;
+class FaceCache;
 struct NodeData;
 struct Myst3GameDescription;
 
@@ -104,6 +105,7 @@ public:
 	Database *_db;
 	Sound *_sound;
 	Ambient *_ambient;
+	FaceCache *_faceCache;
 	
 	Common::RandomSource *_rnd;
 
@@ -251,6 +253,7 @@ private:
 	bool isInventoryVisible();
 
 	void interactWithHoveredElement();
+	void prefetchNodeNeighbours();
 
 	friend class Console;
 };
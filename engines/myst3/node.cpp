@@ -34,13 +34,33 @@
 namespace Myst3 {
 
 void Face::setTextureFromJPEG(const ResourceDescription *jpegDesc) {
-	_bitmap = Myst3Engine::decodeJpeg(jpegDesc);
+	setTextureFromBitmap(Myst3Engine::decodeJpeg(jpegDesc));
+}
+
+void Face::setTextureFromBitmap(Graphics::Surface *bitmap) {
+	_bitmap = bitmap;
 	_texture = _vm->_gfx->createTexture(_bitmap);
 
 	// Set the whole texture as dirty
 	addTextureDirtyRect(Common::Rect(_bitmap->w, _bitmap->h));
 }
 
+void Face::setTextureFromSharedBitmap(const Common::SharedPtr<Graphics::Surface> &bitmap) {
+	_sharedBitmap = bitmap;
+	setTextureFromBitmap(bitmap.get());
+}
+
+Graphics::Surface *Face::getDrawableBitmap() {
+	if (_sharedBitmap) {
+		// Drawing on the face must not alter the bitmap kept in the face cache
+		_bitmap = new Graphics::Surface();
+		_bitmap->copyFrom(*_sharedBitmap);
+		_sharedBitmap.reset();
+	}
+
+	return _bitmap;
+}
+
 Face::Face(Myst3Engine *vm) :
 		_vm(vm),
 		_textureDirty(true),
@@ -71,8 +91,10 @@ void Face::uploadTexture() {
 }
 
 Face::~Face() {
-	_bitmap->free();
-	delete _bitmap;
+	if (!_sharedBitmap) {
+		_bitmap->free();
+		delete _bitmap;
+	}
 	_bitmap = 0;
 
 	if (_finalBitmap) {
@@ -422,8 +444,10 @@ Common::Rect SpotItemFace::getFaceRect() const {
 }
 
 void SpotItemFace::draw() {
+	Graphics::Surface *faceBitmap = _face->getDrawableBitmap();
+
 	for (uint i = 0; i < _bitmap->h; i++) {
-		memcpy(_face->_bitmap->getBasePtr(_posX, _posY + i),
+		memcpy(faceBitmap->getBasePtr(_posX, _posY + i),
 				_bitmap->getBasePtr(0, i),
 				_bitmap->w * 4);
 	}
@@ -433,8 +457,10 @@ void SpotItemFace::draw() {
 }
 
 void SpotItemFace::undraw() {
+	Graphics::Surface *faceBitmap = _face->getDrawableBitmap();
+
 	for (uint i = 0; i < _notDrawnBitmap->h; i++) {
-		memcpy(_face->_bitmap->getBasePtr(_posX, _posY + i),
+		memcpy(faceBitmap->getBasePtr(_posX, _posY + i),
 				_notDrawnBitmap->getBasePtr(0, i),
 				_notDrawnBitmap->w * 4);
 	}
@@ -445,11 +471,12 @@ void SpotItemFace::undraw() {
 
 void SpotItemFace::fadeDraw() {
 	uint16 fadeValue = CLIP<uint16>(_fadeValue, 0, 100);
+	Graphics::Surface *faceBitmap = _face->getDrawableBitmap();
 
 	for (int i = 0; i < _bitmap->h; i++) {
 		byte *ptrND = (byte *)_notDrawnBitmap->getBasePtr(0, i);
 		byte *ptrD = (byte *)_bitmap->getBasePtr(0, i);
-		byte *ptrDest = (byte *)_face->_bitmap->getBasePtr(_posX, _posY + i);
+		byte *ptrDest = (byte *)faceBitmap->getBasePtr(_posX, _posY + i);
 
 		for (int j = 0; j < _bitmap->w; j++) {
 			byte rND = *ptrND++;
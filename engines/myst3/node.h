@@ -27,6 +27,7 @@
 #include "engines/myst3/gfx.h"
 
 #include "common/array.h"
+#include "common/ptr.h"
 #include "common/rect.h"
 
 #include "graphics/surface.h"
@@ -48,6 +49,13 @@ public:
 	~Face();
 
 	void setTextureFromJPEG(const ResourceDescription *jpegDesc);
+	void setTextureFromBitmap(Graphics::Surface *bitmap);
+
+	/** Use a bitmap shared with the face cache, it is copied when first drawn on */
+	void setTextureFromSharedBitmap(const Common::SharedPtr<Graphics::Surface> &bitmap);
+
+	/** Get the bitmap to draw on it */
+	Graphics::Surface *getDrawableBitmap();
 
 	void addTextureDirtyRect(const Common::Rect &rect);
 	bool isTextureDirty() { return _textureDirty; }
@@ -58,6 +66,8 @@ private:
 	bool _textureDirty;
 	Common::Rect _textureDirtyRect;
 
+	Common::SharedPtr<Graphics::Surface> _sharedBitmap;
+
 	Myst3Engine *_vm;
 };
 
@@ -287,6 +287,8 @@ Script::Script(Myst3Engine *vm):
 	}
 
 #undef OP
+
+	buildCommandTable();
 }
 
 Script::~Script() {
@@ -316,13 +318,27 @@ bool Script::run(const Common::Array<Opcode> *script) {
 	return c.result;
 }
 
+void Script::buildCommandTable() {
+	// The invalid opcode is used for the opcodes without a command
+	for (uint i = 0; i < ARRAYSIZE(_commandsByOp); i++)
+		_commandsByOp[i] = &_commands[0];
+
+	for (uint i = 0; i < _commands.size(); i++) {
+		assert(_commands[i].op < ARRAYSIZE(_commandsByOp));
+		_commandsByOp[_commands[i].op] = &_commands[i];
+	}
+
+	// Block delimiters are looked for when skipping over conditional blocks
+	_elseOp = findCommandByProc(&Script::ifElse).op;
+	_whileEndOp = findCommandByProc(&Script::whileEnd).op;
+}
+
 const Script::Command &Script::findCommand(uint16 op) {
-	for (uint16 i = 0; i < _commands.size(); i++)
-		if (_commands[i].op == op)
-			return _commands[i];
+	if (op < ARRAYSIZE(_commandsByOp))
+		return *_commandsByOp[op];
 
 	// Return the invalid opcode if not found
-	return findCommand(0);
+	return *_commandsByOp[0];
 }
 
 const Script::Command &Script::findCommandByProc(CommandProc proc) {
@@ -340,6 +356,25 @@ void Script::shiftCommands(uint16 base, int32 value) {
 			_commands[i].op += value;
 }
 
+void Script::listNodeDestinations(const Common::Array<Opcode> &script, Common::Array<uint16> &nodes) {
+	for (uint i = 0; i < script.size(); i++) {
+		const Opcode &op = script[i];
+		CommandProc proc = findCommand(op.op).proc;
+
+		if (proc != &Script::goToNodeTransition && proc != &Script::goToNodeTrans1
+				&& proc != &Script::goToNodeTrans2 && proc != &Script::zipToNode)
+			continue;
+
+		// Destinations read from variables are not known in advance
+		if (op.args.empty() || op.args[0] <= 0)
+			continue;
+
+		uint16 node = op.args[0];
+		if (Common::find(nodes.begin(), nodes.end(), node) == nodes.end())
+			nodes.push_back(node);
+	}
+}
+
 void Script::runOp(Context &c, const Opcode &op) {
 	const Script::Command &cmd = findCommand(op.op);
 
@@ -1408,12 +1443,10 @@ void Script::ifElse(Context &c, const Opcode &cmd) {
 }
 
 void Script::goToElse(Context &c) {
-	const Command &elseCommand = findCommandByProc(&Script::ifElse);
-
 	// Go to next command until an else statement is met
 	do {
 		c.op++;
-	} while (c.op != c.script->end() && c.op->op != elseCommand.op);
+	} while (c.op != c.script->end() && c.op->op != _elseOp);
 }
 
 void Script::ifCondition(Context &c, const Opcode &cmd) {
@@ -2149,8 +2182,6 @@ void Script::drawWhileCond(Context &c, const Opcode &cmd) {
 }
 
 void Script::whileStart(Context &c, const Opcode &cmd) {
-	const Command &whileEndCommand = findCommandByProc(&Script::whileEnd);
-
 	c.whileStart = c.op - 1;
 
 	// Check the while condition
@@ -2158,7 +2189,7 @@ void Script::whileStart(Context &c, const Opcode &cmd) {
 		// Condition is false, go to the next opcode after the end of the while loop
 		do {
 			c.op++;
-		} while (c.op != c.script->end() && c.op->op != whileEndCommand.op);
+		} while (c.op != c.script->end() && c.op->op != _whileEndOp);
 	}
 
 	_vm->processInput(false);
@@ -43,6 +43,11 @@ public:
 
 	const Common::String describeOpcode(const Opcode &opcode);
 
+	/**
+	 * List the nodes of the current room a script can directly move to
+	 */
+	void listNodeDestinations(const Common::Array<Opcode> &script, Common::Array<uint16> &nodes);
+
 private:
 	struct Context {
 		bool endScript;
@@ -77,12 +82,18 @@ private:
 
 	Common::Array<Command> _commands;
 
+	// Direct lookup table from opcode number to command, opcodes are 8 bits
+	const Command *_commandsByOp[256];
+	uint16 _elseOp;
+	uint16 _whileEndOp;
+
 	const Command &findCommand(uint16 op);
 	const Command &findCommandByProc(CommandProc proc);
 	const Common::String describeCommand(uint16 op);
 	const Common::String describeArgument(char type, int16 value);
 
 	void shiftCommands(uint16 base, int32 value);
+	void buildCommandTable();
 
 	void runOp(Context &c, const Opcode &op);
 	void goToElse(Context &c);
@@ -387,6 +387,10 @@ GameState::GameState(const Common::Platform platform, Database *database):
 
 #undef VAR
 
+	for (VarMap::const_iterator it = _varDescriptions.begin(); it != _varDescriptions.end(); it++) {
+		_varDescriptionsById.setVal(it->_value.var, it->_value);
+	}
+
 	newGame();
 }
 
@@ -609,10 +613,9 @@ void GameState::checkRange(uint16 var) {
 }
 
 const GameState::VarDescription GameState::findDescription(uint16 var) {
-	for (VarMap::const_iterator it = _varDescriptions.begin(); it != _varDescriptions.end(); it++) {
-		if (it->_value.var == var) {
-			return it->_value;
-		}
+	VarIdMap::const_iterator it = _varDescriptionsById.find(var);
+	if (it != _varDescriptionsById.end()) {
+		return it->_value;
 	}
 
 	return VarDescription();
@@ -672,22 +675,17 @@ int32 GameState::valueOrVarValue(int16 value) {
 	return value;
 }
 
-int32 GameState::engineGet(const Common::String &varName) {
-	if (!_varDescriptions.contains(varName))
-		error("The engine is trying to access an undescribed var (%s)", varName.c_str());
-
-	const VarDescription &d = _varDescriptions.getVal(varName);
-
-	return _data.vars[d.var];
+void GameState::resolveEngineVar(EngineVar &engineVar, const char *varName) {
+	VarMap::const_iterator it = _varDescriptions.find(varName);
+	if (it != _varDescriptions.end()) {
+		engineVar.var = it->_value.var;
+	} else {
+		engineVar.var = 0;
+	}
 }
 
-void GameState::engineSet(const Common::String &varName, int32 value) {
-	if (!_varDescriptions.contains(varName))
-		error("The engine is trying to access an undescribed var (%s)", varName.c_str());
-
-	const VarDescription &d = _varDescriptions.getVal(varName);
-
-	_data.vars[d.var] = value;
+void GameState::undescribedEngineVar(const char *varName) {
+	error("The engine is trying to access an undescribed var (%s)", varName);
 }
 
 const Common::String GameState::describeVar(uint16 var) {
@@ -41,10 +41,28 @@ enum ViewType {
 	kMenu = 3
 };
 
+// Each engine var keeps its resolved var id next to its accessors so that
+// the name lookup only happens on first use
 #define DECLARE_VAR(name) \
-	void set##name(int32 value) { engineSet(#name, value); } \
-	int32 get##name() { return engineGet(#name); } \
-	bool hasVar##name() { return _varDescriptions.contains(#name); }
+	void set##name(int32 value) { engineSet(_engineVar##name, #name, value); } \
+	int32 get##name() { return engineGet(_engineVar##name, #name); } \
+	bool hasVar##name() { return engineVarId(_engineVar##name, #name) != 0; } \
+	private: \
+	EngineVar _engineVar##name; \
+	public:
+
+/**
+ * Cached var id of an engine-mapped variable
+ *
+ * The id is resolved from the var descriptions the first time the variable
+ * is accessed. A resolved id of 0 means the variable is not described for
+ * the current platform.
+ */
+struct EngineVar {
+	EngineVar() : var(-1) {}
+
+	int16 var;
+};
 
 class GameState {
 public:
@@ -412,15 +430,40 @@ private:
 	};
 
 	typedef Common::HashMap<Common::String, VarDescription> VarMap;
+	typedef Common::HashMap<uint16, VarDescription> VarIdMap;
 
 	VarMap _varDescriptions;
+	VarIdMap _varDescriptionsById;
 
 	void checkRange(uint16 var);
 	const VarDescription findDescription(uint16 var);
 	void shiftVariables(uint16 base, int32 value);
 
-	int32 engineGet(const Common::String &varName);
-	void engineSet(const Common::String &varName, int32 value);
+	uint16 engineVarId(EngineVar &engineVar, const char *varName) {
+		if (engineVar.var < 0)
+			resolveEngineVar(engineVar, varName);
+
+		return engineVar.var;
+	}
+
+	int32 engineGet(EngineVar &engineVar, const char *varName) {
+		uint16 var = engineVarId(engineVar, varName);
+		if (!var)
+			undescribedEngineVar(varName);
+
+		return _data.vars[var];
+	}
+
+	void engineSet(EngineVar &engineVar, const char *varName, int32 value) {
+		uint16 var = engineVarId(engineVar, varName);
+		if (!var)
+			undescribedEngineVar(varName);
+
+		_data.vars[var] = value;
+	}
+
+	void resolveEngineVar(EngineVar &engineVar, const char *varName);
+	void undescribedEngineVar(const char *varName);
 
 	static void syncFloat(Common::Serializer &s, float &val,
 			Common::Serializer::Version minVersion = 0,
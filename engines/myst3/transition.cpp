@@ -99,6 +99,11 @@ void Transition::draw(TransitionType type) {
 
 		completion = CLIP<int>(100 * (_vm->_state->getTickCount() - startTick) / durationTicks, 0, 100);
 
+		// Keep the sound channels and the ambient sound scripts running, so that
+		// the fades started by the node change progress during the transition.
+		// Movies are not updated, the destination node is a still screenshot.
+		_vm->_sound->update();
+
 		_vm->_gfx->clear();
 
 		drawStep(targetScreenshot, _sourceScreenshot, completion);
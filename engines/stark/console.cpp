@@ -23,8 +23,11 @@
 #include "engines/stark/console.h"
 
 #include "engines/stark/formats/xarc.h"
+#include "engines/stark/gfx/driver.h"
+#include "engines/stark/movement/shortestpath.h"
 #include "engines/stark/resources/object.h"
 #include "engines/stark/resources/anim.h"
+#include "engines/stark/resources/floor.h"
 #include "engines/stark/resources/level.h"
 #include "engines/stark/resources/location.h"
 #include "engines/stark/resources/knowledge.h"
@@ -33,6 +36,7 @@
 #include "engines/stark/resources/knowledgeset.h"
 #include "engines/stark/resources/item.h"
 #include "engines/stark/resources/textureset.h"
+#include "engines/stark/scene.h"
 #include "engines/stark/services/archiveloader.h"
 #include "engines/stark/services/dialogplayer.h"
 #include "engines/stark/services/global.h"
@@ -44,6 +48,7 @@
 
 #include <limits.h>
 #include "common/file.h"
+#include "common/system.h"
 
 namespace Stark {
 
@@ -72,6 +77,9 @@ Console::Console() :
 	registerCmd("changeKnowledge",      WRAP_METHOD(Console, Cmd_ChangeKnowledge));
 	registerCmd("enableInventoryItem",  WRAP_METHOD(Console, Cmd_EnableInventoryItem));
 	registerCmd("extractAllTextures",   WRAP_METHOD(Console, Cmd_ExtractAllTextures));
+	registerCmd("benchPathfinding",     WRAP_METHOD(Console, Cmd_BenchPathfinding));
+	registerCmd("benchFloorRays",       WRAP_METHOD(Console, Cmd_BenchFloorRays));
+	registerCmd("resolveStats",         WRAP_METHOD(Console, Cmd_ResolveStats));
 }
 
 Console::~Console() {
@@ -773,4 +781,128 @@ bool Console::Cmd_Chapter(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::Cmd_BenchPathfinding(int argc, const char **argv) {
+	Current *current = StarkGlobal->getCurrent();
+
+	if (!current) {
+		debugPrintf("Game levels have not been loaded\n");
+		return true;
+	}
+
+	if (argc != 1) {
+		debugPrintf("Compute the shortest path between all the edge pairs of the current location's floor\n");
+		debugPrintf("Usage :\n");
+		debugPrintf("benchPathfinding\n");
+		return true;
+	}
+
+	Resources::Floor *floor = current->getFloor();
+	uint32 edgeCount = floor->getEdgeCount();
+
+	ShortestPath pathSearch;
+	uint32 searchCount = 0;
+	uint32 foundCount = 0;
+	uint32 stepCount = 0;
+
+	uint32 start = g_system->getMillis(true);
+
+	for (uint32 i = 0; i < edgeCount; i++) {
+		const Resources::FloorEdge *startEdge = floor->getEdge(i);
+		if (!startEdge->isEnabled())
+			continue;
+
+		for (uint32 j = 0; j < edgeCount; j++) {
+			ShortestPath::NodeList path = pathSearch.search(floor, startEdge, floor->getEdge(j));
+
+			searchCount++;
+			if (!path.empty()) {
+				foundCount++;
+				stepCount += path.size();
+			}
+		}
+	}
+
+	uint32 elapsed = g_system->getMillis(true) - start;
+
+	debugPrintf("%d edges, %d searches, %d paths found with %d steps in %d ms\n",
+	            edgeCount, searchCount, foundCount, stepCount, elapsed);
+
+	return true;
+}
+
+bool Console::Cmd_BenchFloorRays(int argc, const char **argv) {
+	Current *current = StarkGlobal->getCurrent();
+
+	if (!current) {
+		debugPrintf("Game levels have not been loaded\n");
+		return true;
+	}
+
+	if (argc > 2) {
+		debugPrintf("Cast rays from a grid of mouse positions over the game viewport against the current location's floor\n");
+		debugPrintf("Usage :\n");
+		debugPrintf("benchFloorRays [step]\n");
+		return true;
+	}
+
+	int step = argc == 2 ? atoi(argv[1]) : 4;
+	if (step < 1) {
+		debugPrintf("Invalid step %d\n", step);
+		return true;
+	}
+
+	Resources::Floor *floor = current->getFloor();
+	Common::Rect viewport = StarkGfx->gameViewport();
+
+	uint32 rayCount = 0;
+	uint32 hitCount = 0;
+	uint32 closestCount = 0;
+
+	uint32 start = g_system->getMillis(true);
+
+	for (int y = viewport.top; y < viewport.bottom; y += step) {
+		for (int x = viewport.left; x < viewport.right; x += step) {
+			Math::Ray ray = StarkScene->makeRayFromMouse(Common::Point(x, y));
+			Math::Vector3d position;
+
+			rayCount++;
+			if (floor->findFaceHitByRay(ray, position) >= 0) {
+				hitCount++;
+			} else if (floor->findFaceClosestToRay(ray, position) >= 0) {
+				closestCount++;
+			}
+		}
+	}
+
+	uint32 elapsed = g_system->getMillis(true) - start;
+
+	debugPrintf("%d rays, %d floor hits, %d closest faces in %d ms\n", rayCount, hitCount, closestCount, elapsed);
+
+	return true;
+}
+
+bool Console::Cmd_ResolveStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		debugPrintf("Display the resource reference resolution counters since the last reset\n");
+		debugPrintf("Usage :\n");
+		debugPrintf("resolveStats [reset]\n");
+		return true;
+	}
+
+	ResourceReference::ResolveStats stats = ResourceReference::getResolveStats();
+
+	debugPrintf("%d frames, %d resolves, %d resource tree walks\n", stats.frames, stats.resolves, stats.treeWalks);
+	if (stats.frames > 0) {
+		debugPrintf("%.2f resolves per frame, %.2f resource tree walks per frame\n",
+		            stats.resolves / (float)stats.frames, stats.treeWalks / (float)stats.frames);
+	}
+
+	if (argc == 2) {
+		ResourceReference::resetResolveStats();
+		debugPrintf("The counters have been reset\n");
+	}
+
+	return true;
+}
+
 } // End of namespace Stark
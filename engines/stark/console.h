@@ -64,6 +64,9 @@ private:
 	bool Cmd_ChangeChapter(int argc, const char **argv);
 	bool Cmd_ChangeKnowledge(int argc, const char **argv);
 	bool Cmd_ExtractAllTextures(int argc, const char **argv);
+	bool Cmd_BenchPathfinding(int argc, const char **argv);
+	bool Cmd_BenchFloorRays(int argc, const char **argv);
+	bool Cmd_ResolveStats(int argc, const char **argv);
 
 	Common::Array<Resources::Anim *> listAllLocationAnimations() const;
 	Common::Array<Resources::Script *> listAllLocationScripts() const;
@@ -27,8 +27,6 @@
 #include "engines/stark/debug.h"
 
 #include "common/debug.h"
-#include "common/file.h"
-#include "common/substream.h"
 
 namespace Stark {
 namespace Formats {
@@ -96,7 +94,7 @@ Common::String XARCMember::readString(Common::ReadStream &stream) {
 // ARCHIVE
 
 bool XARCArchive::open(const Common::String &filename) {
-	Common::File stream;
+	Common::File &stream = _file;
 	if (!stream.open(filename)) {
 		return false;
 	}
@@ -120,7 +118,13 @@ bool XARCArchive::open(const Common::String &filename) {
 
 	for (uint32 i = 0; i < numFiles; i++) {
 		XARCMember *member = new XARCMember(this, stream, offset);
-		_members.push_back(Common::ArchiveMemberPtr(member));
+		Common::ArchiveMemberPtr memberPtr(member);
+		_members.push_back(memberPtr);
+
+		// Keep the first member when several have the same name
+		if (!_membersByName.contains(member->getName())) {
+			_membersByName[member->getName()] = memberPtr;
+		}
 
 		// Set the offset to the next member
 		offset += member->getLength();
@@ -134,15 +138,7 @@ Common::String XARCArchive::getFilename() const {
 }
 
 bool XARCArchive::hasFile(const Common::String &name) const {
-	for (Common::ArchiveMemberList::const_iterator it = _members.begin(); it != _members.end(); ++it) {
-		if ((*it)->getName() == name) {
-			// Found it
-			return true;
-		}
-	}
-
-	// Not found
-	return false;
+	return _membersByName.contains(name);
 }
 
 int XARCArchive::listMatchingMembers(Common::ArchiveMemberList &list, const Common::String &pattern) const {
@@ -170,48 +166,38 @@ int XARCArchive::listMembers(Common::ArchiveMemberList &list) const {
 }
 
 const Common::ArchiveMemberPtr XARCArchive::getMember(const Common::String &name) const {
-	for (Common::ArchiveMemberList::const_iterator it = _members.begin(); it != _members.end(); ++it) {
-		if ((*it)->getName() == name) {
-			// Found it
-			return *it;
-		}
+	MemberMap::const_iterator it = _membersByName.find(name);
+	if (it == _membersByName.end()) {
+		// Not found, return an empty ptr
+		return Common::ArchiveMemberPtr();
 	}
 
-	// Not found, return an empty ptr
-	return Common::ArchiveMemberPtr();
+	return it->_value;
 }
 
 Common::SeekableReadStream *XARCArchive::createReadStreamForMember(const Common::String &name) const {
-	for (Common::ArchiveMemberList::const_iterator it = _members.begin(); it != _members.end(); ++it) {
-		if ((*it)->getName() == name) {
-			// Found it
-			return createReadStreamForMember((const XARCMember *)it->get());
-		}
+	MemberMap::const_iterator it = _membersByName.find(name);
+	if (it == _membersByName.end()) {
+		// Not found
+		return 0;
 	}
 
-	// Not found
-	return 0;
+	return createReadStreamForMember((const XARCMember *)it->_value.get());
 }
 
 Common::SeekableReadStream *XARCArchive::createReadStreamForMember(const XARCMember *member) const {
-	// Open the xarc file
-	Common::File *f = new Common::File;
-	if (!f)
+	if (!_file.isOpen()) {
 		return NULL;
+	}
 
-	if (!f->open(_filename)) {
-		delete f;
+	// Read the archive member to memory from the already open archive file.
+	// The returned stream does not depend on the archive, which may be closed
+	// before the stream is released.
+	if (!_file.seek(member->getOffset())) {
 		return NULL;
 	}
 
-	// Return the substream that contains the archive member
-	uint32 offset = member->getOffset();
-	uint32 length = member->getLength();
-	return new Common::SeekableSubReadStream(f, offset, offset + length, DisposeAfterUse::YES);
-
-	// Different approach: keep the archive open and read full resources to memory
-	//f.seek(member->getOffset());
-	//return f.readStream(member->getLength());
+	return _file.readStream(member->getLength());
 }
 
 } // End of namespace Formats
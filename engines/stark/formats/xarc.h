@@ -24,6 +24,9 @@
 #define STARK_ARCHIVE_H
 
 #include "common/archive.h"
+#include "common/file.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "common/stream.h"
 
 namespace Stark {
@@ -46,8 +49,14 @@ public:
 	Common::SeekableReadStream *createReadStreamForMember(const XARCMember *member) const;
 
 private:
+	typedef Common::HashMap<Common::String, Common::ArchiveMemberPtr, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> MemberMap;
+
 	Common::String _filename;
 	Common::ArchiveMemberList _members;
+	MemberMap _membersByName;
+
+	// The archive file is kept open so the members can be read without reopening it
+	mutable Common::File _file;
 };
 
 } // End of namespace Formats
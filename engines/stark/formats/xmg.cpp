@@ -24,11 +24,11 @@
 #include "engines/stark/debug.h"
 #include "engines/stark/gfx/driver.h"
 
-#include "graphics/conversion.h"
 #include "graphics/pixelformat.h"
 #include "graphics/surface.h"
 #include "common/stream.h"
 #include "common/textconsole.h"
+#include "common/util.h"
 
 namespace Stark {
 namespace Formats {
@@ -39,7 +39,11 @@ XMGDecoder::XMGDecoder(Common::ReadStream *stream) :
 		_currX(0),
 		_currY(0),
 		_stream(stream),
-		_transColor(0) {
+		_transColor(0),
+		_bufferPos(0),
+		_bufferSize(0),
+		_streamEnded(false),
+		_eos(false) {
 }
 
 Graphics::Surface *XMGDecoder::decode(Common::ReadStream *stream) {
@@ -90,7 +94,7 @@ Graphics::Surface *XMGDecoder::decodeImage() {
 	surface->create(_width, _height, Gfx::Driver::getRGBAPixelFormat());
 
 	_currX = 0, _currY = 0;
-	while (!_stream->eos()) {
+	while (!_eos) {
 		if (_currX >= _width) {
 			assert(_currX == _width);
 			_currX = 0;
@@ -100,149 +104,150 @@ Graphics::Surface *XMGDecoder::decodeImage() {
 		}
 
 		// Read the number and mode of the tiles
-		byte op = _stream->readByte();
+		byte op = *readData(1);
 		uint16 count;
 		if ((op & 0xC0) != 0xC0) {
 			count = op & 0x3F;
 		} else {
-			count = ((op & 0xF) << 8) + _stream->readByte();
+			count = ((op & 0xF) << 8) + *readData(1);
 			op <<= 2;
 		}
 		op &= 0xC0;
 
+		// The blocks are two lines high, and are written directly to both lines
+		bool drawTwoLines = _currY + 1 < _height;
+		uint32 *row0 = (uint32 *)surface->getBasePtr(0, _currY);
+		uint32 *row1 = drawTwoLines ? row0 + _width : nullptr;
+
 		// Process the current serie
 		for (int i = 0; i < count; i++) {
-			Block block = decodeBlock(op);
-			drawBlock(block, surface);
+			bool drawTwoColumns = _currX + 1 < _width;
+
+			switch (op) {
+				case 0x00:
+					// YCrCb
+					processYCrCb(readData(6), row0 + _currX, row1 ? row1 + _currX : nullptr, drawTwoColumns);
+					break;
+				case 0x40:
+					// Trans
+					processTrans(row0 + _currX, row1 ? row1 + _currX : nullptr, drawTwoColumns);
+					break;
+				case 0x80:
+					// RGB
+					processRGB(readData(12), row0 + _currX, row1 ? row1 + _currX : nullptr, drawTwoColumns);
+					break;
+				default:
+					error("Unsupported color mode '%d'", op);
+			}
+
+			_currX += drawTwoColumns ? 2 : 1;
 		}
 	}
 
 	return surface;
 }
 
-XMGDecoder::Block XMGDecoder::decodeBlock(byte op) {
-	Block block;
-
-	switch (op) {
-		case 0x00:
-			// YCrCb
-			block = processYCrCb();
-			break;
-		case 0x40:
-			// Trans
-			block = processTrans();
-			break;
-		case 0x80:
-			// RGB
-			block = processRGB();
-			break;
-		default:
-			error("Unsupported color mode '%d'", op);
+const byte *XMGDecoder::readData(uint32 size) {
+	assert(size <= kBufferSize);
+
+	if (_bufferPos + size > _bufferSize) {
+		// Move the remaining bytes to the beginning of the buffer and refill it
+		uint32 remaining = _bufferSize - _bufferPos;
+		memmove(_buffer, _buffer + _bufferPos, remaining);
+		_bufferPos = 0;
+		_bufferSize = remaining;
+
+		if (!_streamEnded) {
+			uint32 toRead = kBufferSize - remaining;
+			uint32 readSize = _stream->read(_buffer + remaining, toRead);
+			_bufferSize += readSize;
+			_streamEnded = readSize < toRead || _stream->eos();
+		}
+
+		if (_bufferSize < size) {
+			// Past the end of the stream
+			memset(_buffer + _bufferSize, 0, size - _bufferSize);
+			_bufferSize = size;
+			_eos = true;
+		}
 	}
 
-	return block;
+	const byte *data = _buffer + _bufferPos;
+	_bufferPos += size;
+	return data;
 }
 
-void XMGDecoder::drawBlock(const Block &block, Graphics::Surface *surface) {
-	uint32 *pixels = (uint32 *)surface->getBasePtr(_currX, _currY);
-
-	bool drawTwoColumns = _currX + 1 < _width;
-	bool drawTwoLines = _currY + 1 < _height;
-
-	pixels[0] = TO_LE_32(block.a1);
+static inline uint32 clipColorComponent(int value) {
+	return (uint32)CLIP<int>(value, 0, 255);
+}
 
-	if (drawTwoColumns) {
-		pixels[1] = TO_LE_32(block.a2);
+void XMGDecoder::processYCrCb(const byte *data, uint32 *row0, uint32 *row1, bool drawTwoColumns) {
+	const byte *y = data;
+	int cr = data[4] - 128;
+	int cb = data[5] - 128;
+
+	// Same as Graphics::YUV2RGB, with the chroma contribution shared by the four pixels of the block
+	int rOffset = (1357 * cr) >> 10;
+	int gOffset = - ((691 * cr) >> 10) - ((333 * cb) >> 10);
+	int bOffset = (1715 * cb) >> 10;
+
+	uint32 colors[4];
+	for (uint i = 0; i < 4; i++) {
+		colors[i] = (255u << 24)
+		        + (clipColorComponent(y[i] + bOffset) << 16)
+		        + (clipColorComponent(y[i] + gOffset) << 8)
+		        + clipColorComponent(y[i] + rOffset);
 	}
 
-	if (drawTwoLines) {
-		pixels[_width + 0] = TO_LE_32(block.b1);
+	row0[0] = TO_LE_32(colors[0]);
+	if (drawTwoColumns) {
+		row0[1] = TO_LE_32(colors[1]);
 	}
 
-	if (drawTwoColumns && drawTwoLines) {
-		pixels[_width + 1] = TO_LE_32(block.b2);
+	if (row1) {
+		row1[0] = TO_LE_32(colors[2]);
+		if (drawTwoColumns) {
+			row1[1] = TO_LE_32(colors[3]);
+		}
 	}
-
-	_currX += drawTwoColumns ? 2 : 1;
 }
 
-XMGDecoder::Block XMGDecoder::processYCrCb() {
-	byte y0, y1, y2, y3;
-	byte cr, cb;
-
-	y0 = _stream->readByte();
-	y1 = _stream->readByte();
-	y2 = _stream->readByte();
-	y3 = _stream->readByte();
-	cr = _stream->readByte();
-	cb = _stream->readByte();
-
-	byte r, g, b;
-	Block block;
-
-	Graphics::YUV2RGB(y0, cb, cr, r, g, b);
-	block.a1 = (255u << 24) + (b << 16) + (g << 8) + r;
-
-	Graphics::YUV2RGB(y1, cb, cr, r, g, b);
-	block.a2 = (255u << 24) + (b << 16) + (g << 8) + r;
-
-	Graphics::YUV2RGB(y2, cb, cr, r, g, b);
-	block.b1 = (255u << 24) + (b << 16) + (g << 8) + r;
-
-	Graphics::YUV2RGB(y3, cb, cr, r, g, b);
-	block.b2 = (255u << 24) + (b << 16) + (g << 8) + r;
+void XMGDecoder::processTrans(uint32 *row0, uint32 *row1, bool drawTwoColumns) {
+	row0[0] = 0;
+	if (drawTwoColumns) {
+		row0[1] = 0;
+	}
 
-	return block;
+	if (row1) {
+		row1[0] = 0;
+		if (drawTwoColumns) {
+			row1[1] = 0;
+		}
+	}
 }
 
-XMGDecoder::Block XMGDecoder::processTrans() {
-	Block block;
-
-	block.a1 = 0;
-	block.a2 = 0;
-	block.b1 = 0;
-	block.b2 = 0;
+void XMGDecoder::processRGB(const byte *data, uint32 *row0, uint32 *row1, bool drawTwoColumns) {
+	row0[0] = TO_LE_32(readRGBColor(data + 0));
+	if (drawTwoColumns) {
+		row0[1] = TO_LE_32(readRGBColor(data + 3));
+	}
 
-	return block;
+	if (row1) {
+		row1[0] = TO_LE_32(readRGBColor(data + 6));
+		if (drawTwoColumns) {
+			row1[1] = TO_LE_32(readRGBColor(data + 9));
+		}
+	}
 }
 
-XMGDecoder::Block XMGDecoder::processRGB() {
-	Block block;
-	uint32 color;
-
-	color = _stream->readUint16LE();
-	color += _stream->readByte() << 16;
-	if (color != _transColor)
-		color += 255 << 24;
-	else
-		color = 0;
-	block.a1 = color;
-
-	color = _stream->readUint16LE();
-	color += _stream->readByte() << 16;
-	if (color != _transColor)
-		color += 255 << 24;
-	else
-		color = 0;
-	block.a2 = color;
-
-	color = _stream->readUint16LE();
-	color += _stream->readByte() << 16;
-	if (color != _transColor)
-		color += 255 << 24;
-	else
-		color = 0;
-	block.b1 = color;
-
-	color = _stream->readUint16LE();
-	color += _stream->readByte() << 16;
+uint32 XMGDecoder::readRGBColor(const byte *data) const {
+	uint32 color = READ_LE_UINT16(data) + (data[2] << 16);
 	if (color != _transColor)
 		color += 255 << 24;
 	else
 		color = 0;
-	block.b2 = color;
 
-	return block;
+	return color;
 }
 
 } // End of namespace Formats
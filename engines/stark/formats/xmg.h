@@ -43,19 +43,21 @@ public:
 private:
 	explicit XMGDecoder(Common::ReadStream *stream);
 
-	struct Block {
-		uint32 a1, a2;
-		uint32 b1, b2;
-	};
-
 	void readHeader();
 	Graphics::Surface *decodeImage();
-	Block decodeBlock(byte op);
-	void drawBlock(const Block &block, Graphics::Surface *surface);
 
-	Block processYCrCb();
-	Block processTrans();
-	Block processRGB();
+	/**
+	 * Get a pointer to the next bytes of the compressed data
+	 *
+	 * The data is read from the stream in large chunks. Bytes past the end
+	 * of the stream read as zeros, and set the end of stream flag.
+	 */
+	const byte *readData(uint32 size);
+
+	void processYCrCb(const byte *data, uint32 *row0, uint32 *row1, bool drawTwoColumns);
+	void processTrans(uint32 *row0, uint32 *row1, bool drawTwoColumns);
+	void processRGB(const byte *data, uint32 *row0, uint32 *row1, bool drawTwoColumns);
+	uint32 readRGBColor(const byte *data) const;
 
 	uint32 _width;
 	uint32 _height;
@@ -71,6 +73,13 @@ private:
 	 * alpha. So the images are effectively pre-multiplied alpha.
 	 */
 	uint32 _transColor;
+
+	static const uint32 kBufferSize = 8192;
+	byte _buffer[kBufferSize];
+	uint32 _bufferPos;
+	uint32 _bufferSize;
+	bool _streamEnded;
+	bool _eos;
 };
 
 } // End of namespace Formats
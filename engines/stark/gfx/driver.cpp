@@ -22,9 +22,11 @@
 
 #include "engines/stark/gfx/driver.h"
 #include "engines/stark/gfx/opengls.h"
+#include "engines/stark/gfx/tinygl.h"
 
 #include "common/config-manager.h"
 
+#include "graphics/renderer.h"
 #include "graphics/surface.h"
 #ifdef USE_OPENGL
 #include "graphics/opengl/context.h"
@@ -34,18 +36,47 @@ namespace Stark {
 namespace Gfx {
 
 Driver *Driver::create() {
+	Common::String rendererConfig = ConfMan.get("renderer");
+	Graphics::RendererType desiredRendererType = Graphics::parseRendererTypeCode(rendererConfig);
+	Graphics::RendererType matchingRendererType = Graphics::getBestMatchingAvailableRendererType(desiredRendererType);
+
+	// There is no fixed function OpenGL renderer for this engine
+	if (matchingRendererType == Graphics::kRendererTypeOpenGL) {
 #if defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+		matchingRendererType = Graphics::kRendererTypeOpenGLShaders;
+#else
+		matchingRendererType = Graphics::kRendererTypeTinyGL;
+#endif
+	}
+
 	bool fullscreen = ConfMan.getBool("fullscreen");
-	g_system->setupScreen(kOriginalWidth, kOriginalHeight, fullscreen, true);
+	bool isAccelerated = matchingRendererType != Graphics::kRendererTypeTinyGL;
+	g_system->setupScreen(kOriginalWidth, kOriginalHeight, fullscreen, isAccelerated);
+
+#if defined(USE_OPENGL)
+	// Check the OpenGL context actually supports shaders
+	if (matchingRendererType == Graphics::kRendererTypeOpenGLShaders && !OpenGLContext.shadersSupported) {
+		warning("Your system does not have the required OpenGL capabilities, falling back to the software renderer");
+		matchingRendererType = Graphics::kRendererTypeTinyGL;
+		g_system->setupScreen(kOriginalWidth, kOriginalHeight, fullscreen, false);
+	}
+#endif
+
+	if (matchingRendererType != desiredRendererType && desiredRendererType != Graphics::kRendererTypeDefault) {
+		// Display a warning if unable to use the desired renderer
+		warning("Unable to create a '%s' renderer", rendererConfig.c_str());
+	}
 
-	if (OpenGLContext.shadersSupported) {
+#if defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+	if (matchingRendererType == Graphics::kRendererTypeOpenGLShaders) {
 		return new OpenGLSDriver();
-	} else {
-		error("Your system does not have the required OpenGL capabilities");
 	}
 #endif // defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+	if (matchingRendererType == Graphics::kRendererTypeTinyGL) {
+		return new TinyGLDriver();
+	}
 
-	error("No renderers have been found for this game");
+	error("Unable to create a '%s' renderer", rendererConfig.c_str());
 }
 
 const Graphics::PixelFormat Driver::getRGBAPixelFormat() {
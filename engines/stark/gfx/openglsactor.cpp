@@ -22,6 +22,8 @@
 
 #include "engines/stark/gfx/openglsactor.h"
 
+#if defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+
 #include "engines/stark/model/model.h"
 #include "engines/stark/model/animhandler.h"
 #include "engines/stark/scene.h"
@@ -309,122 +311,11 @@ void OpenGLSActorRenderer::setLightArrayUniform(const LightEntryArray &lights) {
 
 void OpenGLSActorRenderer::setShadowUniform(const LightEntryArray &lights,
 		const Math::Vector3d &actorPosition, Math::Matrix3 worldToModelRot) {
-	Math::Vector3d sumDirection;
-	bool hasLight = false;
-
-	// Compute the contribution from each lights
-	// The ambient light is skipped intentionally
-	for (uint i = 1; i < lights.size(); ++i) {
-		LightEntry *light = lights[i];
-		bool contributes = false;
-
-		Math::Vector3d lightDirection;
-		switch (light->type) {
-			case LightEntry::kPoint:
-				contributes = getPointLightContribution(light, actorPosition, lightDirection);
-				break;
-			case LightEntry::kDirectional:
-				contributes = getDirectionalLightContribution(light, lightDirection);
-				break;
-			case LightEntry::kSpot:
-				contributes = getSpotLightContribution(light, actorPosition, lightDirection);
-				break;
-			case LightEntry::kAmbient:
-			default:
-				break;
-		}
-
-		if (contributes) {
-			sumDirection += lightDirection;
-			hasLight = true;
-		}
-	}
-
-	if (hasLight) {
-		// Clip the horizontal length
-		Math::Vector2d horizontalProjection(sumDirection.x(), sumDirection.y());
-		float shadowLength = MIN(horizontalProjection.getMagnitude(), StarkScene->getMaxShadowLength());
-
-		horizontalProjection.normalize();
-		horizontalProjection *= shadowLength;
-
-		sumDirection.x() = horizontalProjection.getX();
-		sumDirection.y() = horizontalProjection.getY();
-		sumDirection.z() = -1;
-	} else {
-		// Cast from above by default
-		sumDirection.x() = 0;
-		sumDirection.y() = 0;
-		sumDirection.z() = -1;
-	}
-
-	//Transform the direction to the model space and pass to the shader
-	sumDirection = worldToModelRot * sumDirection;
-	_shadowShader->setUniform("lightDirection", sumDirection);
-}
-
-bool OpenGLSActorRenderer::getPointLightContribution(LightEntry *light,
-		const Math::Vector3d &actorPosition, Math::Vector3d &direction, float weight) {
-	float distance = light->position.getDistanceTo(actorPosition);
-
-	if (distance > light->falloffFar) {
-		return false;
-	}
-
-	float factor;
-	if (distance > light->falloffNear) {
-		if (light->falloffFar - light->falloffNear > 1) {
-			factor = 1 - (distance - light->falloffNear) / (light->falloffFar - light->falloffNear);
-		} else {
-			factor = 0;
-		}
-	} else {
-		factor = 1;
-	}
-
-	float brightness = (light->color.x() + light->color.y() + light->color.z()) / 3.0f;
-
-	if (factor <= 0 || brightness <= 0) {
-		return false;
-	}
-
-	direction = actorPosition - light->position;
-	direction.normalize();
-	direction *= factor * brightness * weight;
-
-	return true;
-}
-
-bool OpenGLSActorRenderer::getDirectionalLightContribution(LightEntry *light, Math::Vector3d &direction) {
-	float brightness = (light->color.x() + light->color.y() + light->color.z()) / 3.0f;
-
-	if (brightness <= 0) {
-		return false;
-	}
-
-	direction = light->direction;
-	direction.normalize();
-	direction *= brightness;
-
-	return true;
-}
-
-bool OpenGLSActorRenderer::getSpotLightContribution(LightEntry *light,
-		const Math::Vector3d &actorPosition, Math::Vector3d &direction) {
-	Math::Vector3d lightToActor = actorPosition - light->position;
-	lightToActor.normalize();
-
-	float cosAngle = MAX(0.0f, lightToActor.dotProduct(light->direction));
-	float cone = (cosAngle - light->innerConeAngle.getCosine()) /
-			MAX(0.001f, light->outerConeAngle.getCosine() - light->innerConeAngle.getCosine());
-	cone = CLIP(cone, 0.0f, 1.0f);
-
-	if (cone <= 0) {
-		return false;
-	}
-
-	return getPointLightContribution(light, actorPosition, direction, cone);
+	Math::Vector3d lightDirection = computeShadowDirection(lights, actorPosition, worldToModelRot);
+	_shadowShader->setUniform("lightDirection", lightDirection);
 }
 
 } // End of namespace Gfx
 } // End of namespace Stark
+
+#endif // defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
@@ -29,6 +29,8 @@
 #include "common/hashmap.h"
 #include "common/hash-ptr.h"
 
+#if defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+
 #include "graphics/opengl/system_headers.h"
 
 namespace OpenGL {
@@ -65,14 +67,11 @@ protected:
 	void setLightArrayUniform(const LightEntryArray &lights);
 
 	void setShadowUniform(const LightEntryArray &lights, const Math::Vector3d &actorPosition, Math::Matrix3 worldToModelRot);
-	
-	bool getPointLightContribution(LightEntry *light, const Math::Vector3d &actorPosition,
-			Math::Vector3d &direction, float weight = 1.0f);
-	bool getDirectionalLightContribution(LightEntry *light, Math::Vector3d &direction);
-	bool getSpotLightContribution(LightEntry *light, const Math::Vector3d &actorPosition, Math::Vector3d &direction);
 };
 
 } // End of namespace Gfx
 } // End of namespace Stark
 
+#endif // defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+
 #endif // STARK_GFX_OPENGL_S_ACTOR_H
@@ -22,6 +22,8 @@
 
 #include "engines/stark/gfx/openglsfade.h"
 
+#if defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+
 #include "engines/stark/gfx/opengls.h"
 
 #include "graphics/opengl/shader.h"
@@ -52,3 +54,5 @@ void OpenGLSFadeRenderer::render(float fadeLevel) {
 
 } // End of namespace Gfx
 } // End of namespace Stark
+
+#endif // defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
@@ -22,6 +22,8 @@
 
 #include "engines/stark/gfx/openglsprop.h"
 
+#if defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+
 #include "engines/stark/gfx/driver.h"
 #include "engines/stark/gfx/texture.h"
 #include "engines/stark/formats/biffmesh.h"
@@ -190,3 +192,5 @@ void OpenGLSPropRenderer::setLightArrayUniform(const LightEntryArray &lights) {
 
 } // End of namespace Gfx
 } // End of namespace Stark
+
+#endif // defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
@@ -29,6 +29,8 @@
 #include "common/hashmap.h"
 #include "common/hash-ptr.h"
 
+#if defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+
 #include "graphics/opengl/system_headers.h"
 
 namespace OpenGL {
@@ -70,4 +72,6 @@ protected:
 } // End of namespace Gfx
 } // End of namespace Stark
 
+#endif // defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+
 #endif // STARK_GFX_OPENGL_S_RENDERED_H
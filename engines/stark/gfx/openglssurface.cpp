@@ -22,6 +22,8 @@
 
 #include "engines/stark/gfx/openglssurface.h"
 
+#if defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+
 #include "engines/stark/gfx/opengls.h"
 #include "engines/stark/gfx/texture.h"
 
@@ -80,3 +82,5 @@ Math::Vector2d OpenGLSSurfaceRenderer::normalizeCurrentCoordinates(int x, int y)
 
 } // End of namespace Gfx
 } // End of namespace Stark
+
+#endif // defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
@@ -22,6 +22,8 @@
 
 #include "engines/stark/gfx/opengltexture.h"
 
+#if defined(USE_OPENGL) || defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+
 #include "engines/stark/gfx/driver.h"
 
 #include "graphics/surface.h"
@@ -78,6 +80,24 @@ void OpenGlTexture::update(const Graphics::Surface *surface, const byte *palette
 	updateLevel(0, surface, palette);
 }
 
+void OpenGlTexture::updateArea(const Graphics::Surface *surface, const Common::Rect &area) {
+	assert(surface->format == Driver::getRGBAPixelFormat());
+	assert(surface->w == _width && surface->h == _height);
+
+	if (area.isEmpty()) {
+		return;
+	}
+
+	// GLES2 has no unpack row length, copy the area rows so they are contiguous
+	Graphics::Surface areaPixels;
+	areaPixels.copyFrom(surface->getSubArea(area));
+
+	bind();
+	glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top, area.width(), area.height(), GL_RGBA, GL_UNSIGNED_BYTE, areaPixels.getPixels());
+
+	areaPixels.free();
+}
+
 void OpenGlTexture::setSamplingFilter(Texture::SamplingFilter filter) {
 	assert(_levelCount == 0);
 
@@ -127,3 +147,5 @@ void OpenGlTexture::addLevel(uint32 level, const Graphics::Surface *surface, con
 
 } // End of namespace Gfx
 } // End of namespace Stark
+
+#endif // defined(USE_OPENGL) || defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
@@ -25,6 +25,8 @@
 
 #include "engines/stark/gfx/texture.h"
 
+#if defined(USE_OPENGL) || defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+
 #include "graphics/opengl/system_headers.h"
 
 namespace Stark {
@@ -41,6 +43,7 @@ public:
 	// Texture API
 	void bind() const override;
 	void update(const Graphics::Surface *surface, const byte *palette = nullptr) override;
+	void updateArea(const Graphics::Surface *surface, const Common::Rect &area) override;
 	void setSamplingFilter(SamplingFilter filter) override;
 	void setLevelCount(uint32 count) override;
 	void addLevel(uint32 level, const Graphics::Surface *surface, const byte *palette = nullptr) override;
@@ -55,4 +58,6 @@ protected:
 } // End of namespace Gfx
 } // End of namespace Stark
 
+#endif // defined(USE_OPENGL) || defined(USE_GLES2) || defined(USE_OPENGL_SHADERS)
+
 #endif // STARK_GFX_OPENGL_TEXTURE_H
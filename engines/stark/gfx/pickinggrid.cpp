@@ -0,0 +1,116 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/stark/gfx/pickinggrid.h"
+
+#include "engines/stark/gfx/driver.h"
+
+#include "common/algorithm.h"
+
+namespace Stark {
+namespace Gfx {
+
+PickingGrid::PickingGrid() :
+		_columns((Driver::kGameViewportWidth + kCellSize - 1) / kCellSize),
+		_rows((Driver::kGameViewportHeight + kCellSize - 1) / kCellSize) {
+	_cells.resize(_columns * _rows);
+}
+
+void PickingGrid::clear() {
+	for (uint i = 0; i < _cells.size(); i++) {
+		_cells[i].clear();
+	}
+
+	_unboundedEntries.clear();
+}
+
+void PickingGrid::build(const RenderEntryArray &entries) {
+	clear();
+
+	for (uint i = 0; i < entries.size(); i++) {
+		Common::Rect rect;
+		if (!entries[i]->getPickingRect(rect)) {
+			_unboundedEntries.push_back(i);
+			continue;
+		}
+
+		if (rect.isEmpty()) {
+			continue; // The entry can't be picked
+		}
+
+		int firstColumn = MAX<int>(rect.left / kCellSize, 0);
+		int lastColumn = MIN<int>((rect.right - 1) / kCellSize, _columns - 1);
+		int firstRow = MAX<int>(rect.top / kCellSize, 0);
+		int lastRow = MIN<int>((rect.bottom - 1) / kCellSize, _rows - 1);
+
+		for (int row = firstRow; row <= lastRow; row++) {
+			for (int column = firstColumn; column <= lastColumn; column++) {
+				_cells[row * _columns + column].push_back(i);
+			}
+		}
+	}
+}
+
+void PickingGrid::addCandidatesFromCells(const Common::Rect &rect, Common::Array<uint> &candidates) const {
+	if (rect.right <= 0 || rect.bottom <= 0) {
+		return;
+	}
+
+	int firstColumn = MAX<int>(rect.left / kCellSize, 0);
+	int lastColumn = MIN<int>((rect.right - 1) / kCellSize, _columns - 1);
+	int firstRow = MAX<int>(rect.top / kCellSize, 0);
+	int lastRow = MIN<int>((rect.bottom - 1) / kCellSize, _rows - 1);
+
+	for (int row = firstRow; row <= lastRow; row++) {
+		for (int column = firstColumn; column <= lastColumn; column++) {
+			const Common::Array<uint> &cell = _cells[row * _columns + column];
+			candidates.push_back(cell);
+		}
+	}
+}
+
+void PickingGrid::listCandidates(const Common::Point &position, const Common::Rect &cursorRect, Common::Array<uint> &candidates) const {
+	candidates.clear();
+
+	Common::Rect queryRect(position.x, position.y, position.x + 1, position.y + 1);
+	if (!cursorRect.isEmpty()) {
+		// Small items are hit when they intersect the cursor
+		queryRect.extend(cursorRect);
+	}
+
+	addCandidatesFromCells(queryRect, candidates);
+	candidates.push_back(_unboundedEntries);
+
+	// Test the nearest entries first, each only once
+	Common::sort(candidates.begin(), candidates.end(), Common::Greater<uint>());
+
+	uint uniqueCount = 0;
+	for (uint i = 0; i < candidates.size(); i++) {
+		if (uniqueCount == 0 || candidates[uniqueCount - 1] != candidates[i]) {
+			candidates[uniqueCount++] = candidates[i];
+		}
+	}
+	candidates.resize(uniqueCount);
+}
+
+} // End of namespace Gfx
+} // End of namespace Stark
@@ -0,0 +1,74 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef STARK_GFX_PICKING_GRID_H
+#define STARK_GFX_PICKING_GRID_H
+
+#include "engines/stark/gfx/renderentry.h"
+
+#include "common/array.h"
+#include "common/rect.h"
+
+namespace Stark {
+namespace Gfx {
+
+/**
+ * A screen space index of the render entries for mouse picking
+ *
+ * The game window is divided into cells. Each cell lists the 2D render
+ * entries whose picking area overlaps it. 3D render entries need a ray
+ * test and are listed as candidates for all the positions.
+ */
+class PickingGrid {
+public:
+	PickingGrid();
+
+	/** Index a list of render entries sorted from the farthest to the nearest */
+	void build(const RenderEntryArray &entries);
+
+	/** Forget about the indexed render entries */
+	void clear();
+
+	/**
+	 * List the indices of the entries that may contain a position, from the nearest to the farthest
+	 *
+	 * @param position game window coordinates to test
+	 * @param cursorRect cursor rectangle used to test small world items, may be empty
+	 * @param candidates indices of the candidate entries in the indexed list
+	 */
+	void listCandidates(const Common::Point &position, const Common::Rect &cursorRect, Common::Array<uint> &candidates) const;
+
+private:
+	static const int kCellSize = 32;
+
+	void addCandidatesFromCells(const Common::Rect &rect, Common::Array<uint> &candidates) const;
+
+	int _columns;
+	int _rows;
+	Common::Array< Common::Array<uint> > _cells;
+	Common::Array<uint> _unboundedEntries;
+};
+
+} // End of namespace Gfx
+} // End of namespace Stark
+
+#endif // STARK_GFX_PICKING_GRID_H
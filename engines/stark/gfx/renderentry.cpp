@@ -185,6 +185,53 @@ bool RenderEntry::containsPoint(const Common::Point &position, Common::Point &re
 	return false;
 }
 
+static void extendPickingRect(Common::Rect &rect, const Common::Rect &other) {
+	if (rect.isEmpty()) {
+		rect = other;
+	} else if (!other.isEmpty()) {
+		rect.extend(other);
+	}
+}
+
+bool RenderEntry::getPickingRect(Common::Rect &rect) const {
+	rect = Common::Rect();
+
+	if (!_visual || !_clickable) {
+		return true;
+	}
+
+	if (_visual->get<VisualActor>() || _visual->get<VisualProp>()) {
+		return false;
+	}
+
+	VisualImageXMG *image = _visual->get<VisualImageXMG>();
+	if (image) {
+		Common::Rect imageRect = Common::Rect(image->getWidth(), image->getHeight());
+		imageRect.translate(_position.x, _position.y);
+		imageRect.translate(-image->getHotspot().x, -image->getHotspot().y);
+		extendPickingRect(rect, imageRect);
+	}
+
+	VisualSmacker *smacker = _visual->get<VisualSmacker>();
+	if (smacker) {
+		Common::Point smackerPosition = smacker->getPosition();
+		smackerPosition -= _position;
+
+		Common::Rect smackerRect = Common::Rect(smacker->getWidth(), smacker->getHeight());
+		smackerRect.translate(smackerPosition.x, smackerPosition.y);
+		extendPickingRect(rect, smackerRect);
+	}
+
+	VisualText *text = _visual->get<VisualText>();
+	if (text) {
+		Common::Rect textRect = text->getRect();
+		textRect.translate(_position.x, _position.y);
+		extendPickingRect(rect, textRect);
+	}
+
+	return true;
+}
+
 bool RenderEntry::intersectRay(const Math::Ray &ray) const {
 	if (!_visual || !_clickable) {
 		return false;
@@ -103,6 +103,14 @@ public:
 	/** Mouse picking test for 3D items */
 	bool intersectRay(const Math::Ray &ray) const;
 
+	/**
+	 * Compute the game window area where the item can be picked
+	 *
+	 * @param rect area containing all the points accepted by containsPoint, empty if the item can't be picked
+	 * @return false for 3D items, which are picked using ray intersection anywhere in the window
+	 */
+	bool getPickingRect(Common::Rect &rect) const;
+
 	/** Compare two render entries by their sort keys */
 	static bool compare(const RenderEntry *x, const RenderEntry *y);
 
@@ -24,6 +24,7 @@
 #define STARK_GFX_TEXTURE_H
 
 #include "common/hash-str.h"
+#include "common/rect.h"
 
 namespace Graphics {
 	struct Surface;
@@ -51,6 +52,14 @@ public:
 	/** Define or update the texture pixel data */
 	virtual void update(const Graphics::Surface *surface, const byte *palette = nullptr) = 0;
 
+	/**
+	 * Update part of the texture pixel data
+	 *
+	 * The surface must have the texture's size and pixel format.
+	 * Only the pixels inside the area are uploaded.
+	 */
+	virtual void updateArea(const Graphics::Surface *surface, const Common::Rect &area) = 0;
+
 	/** Set the filter used when sampling the texture */
 	virtual void setSamplingFilter(SamplingFilter filter) = 0;
 
@@ -0,0 +1,76 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef STARK_GFX_TINYGL_H
+#define STARK_GFX_TINYGL_H
+
+#include "common/system.h"
+
+#include "engines/stark/gfx/driver.h"
+
+#include "graphics/tinygl/zgl.h"
+
+namespace Stark {
+namespace Gfx {
+
+/**
+ * A software renderer based on TinyGL
+ */
+class TinyGLDriver : public Driver {
+public:
+	TinyGLDriver();
+	~TinyGLDriver();
+
+	void init() override;
+
+	void setScreenViewport(bool noScaling) override;
+	void setViewport(const Common::Rect &rect) override;
+
+	void clearScreen() override;
+	void flipBuffer() override;
+
+	Texture *createTexture(const Graphics::Surface *surface = nullptr, const byte *palette = nullptr) override;
+	VisualActor *createActorRenderer() override;
+	VisualProp *createPropRenderer() override;
+	SurfaceRenderer *createSurfaceRenderer() override;
+	FadeRenderer *createFadeRenderer() override;
+
+	void start2DMode();
+	void end2DMode();
+	void set3DMode() override;
+
+	Common::Rect getViewport() const;
+	Common::Rect getUnscaledViewport() const;
+
+	Graphics::Surface *getViewportScreenshot() const override;
+
+private:
+	Common::Rect _viewport;
+	Common::Rect _unscaledViewport;
+
+	TinyGL::FrameBuffer *_fb;
+};
+
+} // End of namespace Gfx
+} // End of namespace Stark
+
+#endif // STARK_GFX_TINYGL_H
@@ -0,0 +1,207 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/stark/gfx/tinyglactor.h"
+
+#include "engines/stark/model/model.h"
+#include "engines/stark/model/animhandler.h"
+#include "engines/stark/scene.h"
+#include "engines/stark/services/services.h"
+#include "engines/stark/services/settings.h"
+#include "engines/stark/gfx/tinygl.h"
+#include "engines/stark/gfx/tinygltexture.h"
+
+namespace Stark {
+namespace Gfx {
+
+TinyGLActorRenderer::TinyGLActorRenderer(TinyGLDriver *gfx) :
+		VisualActor(),
+		_gfx(gfx) {
+}
+
+TinyGLActorRenderer::~TinyGLActorRenderer() {
+}
+
+void TinyGLActorRenderer::render(const Math::Vector3d &position, float direction, const LightEntryArray &lights) {
+	// TODO: Move updates outside of the rendering code
+	_animHandler->animate(_time);
+	_model->updateBoundingBox();
+
+	_gfx->set3DMode();
+
+	Math::Matrix4 model = getModelMatrix(position, direction);
+	Math::Matrix4 view = StarkScene->getViewMatrix();
+	Math::Matrix4 projection = StarkScene->getProjectionMatrix();
+
+	Math::Matrix4 modelViewMatrix = view * model;
+
+	skinVertices();
+
+	_lights.setLights(lights, view);
+	shadeVertices(modelViewMatrix);
+
+	Math::Matrix4 projectionMatrix = projection;
+	projectionMatrix.transpose(); // TinyGL expects matrices transposed when compared to ResidualVM's
+
+	Math::Matrix4 glModelViewMatrix = modelViewMatrix;
+	glModelViewMatrix.transpose(); // TinyGL expects matrices transposed when compared to ResidualVM's
+
+	tglMatrixMode(TGL_PROJECTION);
+	tglLoadMatrixf(projectionMatrix.getData());
+
+	tglMatrixMode(TGL_MODELVIEW);
+	tglLoadMatrixf(glModelViewMatrix.getData());
+
+	const Common::Array<VertNode *> &vertices = _model->getVertices();
+	const Common::Array<Face *> &faces = _model->getFaces();
+	const Common::Array<Material *> &mats = _model->getMaterials();
+
+	for (Common::Array<Face *>::const_iterator face = faces.begin(); face != faces.end(); ++face) {
+		const Material *material = mats[(*face)->materialId];
+		const Gfx::Texture *tex = resolveTexture(material);
+		if (tex) {
+			tglEnable(TGL_TEXTURE_2D);
+			tex->bind();
+		} else {
+			tglDisable(TGL_TEXTURE_2D);
+		}
+
+		Math::Vector3d color = tex ? Math::Vector3d(1.0f, 1.0f, 1.0f) : Math::Vector3d(material->r, material->g, material->b);
+
+		tglBegin(TGL_TRIANGLES);
+		for (uint i = 0; i < (*face)->vertexIndices.size(); i++) {
+			uint32 index = (*face)->vertexIndices[i];
+			const VertNode *vertex = vertices[index];
+			const Math::Vector3d &light = _vertexColors[index];
+			const Math::Vector3d &pos = _skinnedPositions[index];
+
+			tglColor4f(color.x() * light.x(), color.y() * light.y(), color.z() * light.z(), 1.0f);
+			tglTexCoord2f(-vertex->_texS, vertex->_texT);
+			tglVertex3f(pos.x(), pos.y(), pos.z());
+		}
+		tglEnd();
+	}
+
+	tglDisable(TGL_TEXTURE_2D);
+
+	if (_castsShadow
+	        && StarkScene->shouldRenderShadows()
+	        && StarkSettings->getBoolSetting(Settings::kShadow)) {
+		Math::Matrix4 mvp = projection * view * model;
+
+		Math::Matrix4 modelInverse = model;
+		modelInverse.inverse();
+		Math::Vector3d lightDirection = computeShadowDirection(lights, position, modelInverse.getRotation());
+
+		renderShadow(mvp, lightDirection);
+	}
+}
+
+void TinyGLActorRenderer::skinVertices() {
+	const Common::Array<VertNode *> &vertices = _model->getVertices();
+	const Common::Array<BoneNode *> &bones = _model->getBones();
+
+	_skinnedPositions.resize(vertices.size());
+
+	for (uint i = 0; i < vertices.size(); i++) {
+		const VertNode *vertex = vertices[i];
+		const BoneNode *bone1 = bones[vertex->_bone1];
+		const BoneNode *bone2 = bones[vertex->_bone2];
+
+		Math::Vector3d b1 = vertex->_pos1;
+		bone1->_animRot.transform(b1);
+		b1 += bone1->_animPos;
+
+		Math::Vector3d b2 = vertex->_pos2;
+		bone2->_animRot.transform(b2);
+		b2 += bone2->_animPos;
+
+		_skinnedPositions[i] = b2 + (b1 - b2) * vertex->_boneWeight;
+	}
+}
+
+void TinyGLActorRenderer::shadeVertices(const Math::Matrix4 &modelView) {
+	const Common::Array<VertNode *> &vertices = _model->getVertices();
+	const Common::Array<BoneNode *> &bones = _model->getBones();
+
+	Math::Matrix3 normalMatrix = modelView.getRotation();
+
+	_vertexColors.resize(vertices.size());
+
+	for (uint i = 0; i < vertices.size(); i++) {
+		const VertNode *vertex = vertices[i];
+
+		Math::Vector3d n1 = vertex->_normal;
+		bones[vertex->_bone1]->_animRot.transform(n1);
+
+		Math::Vector3d n2 = vertex->_normal;
+		bones[vertex->_bone2]->_animRot.transform(n2);
+
+		Math::Vector3d eyeNormal = n2 + (n1 - n2) * vertex->_boneWeight;
+		eyeNormal.normalize();
+		eyeNormal = normalMatrix * eyeNormal;
+		eyeNormal.normalize();
+
+		Math::Vector3d eyePosition = _skinnedPositions[i];
+		modelView.transform(&eyePosition, true);
+
+		_vertexColors[i] = _lights.shade(eyePosition, eyeNormal);
+	}
+}
+
+void TinyGLActorRenderer::renderShadow(const Math::Matrix4 &mvp, const Math::Vector3d &lightDirection) {
+	Math::Matrix4 mvpMatrix = mvp;
+	mvpMatrix.transpose(); // TinyGL expects matrices transposed when compared to ResidualVM's
+
+	tglMatrixMode(TGL_PROJECTION);
+	tglLoadIdentity();
+
+	tglMatrixMode(TGL_MODELVIEW);
+	tglLoadMatrixf(mvpMatrix.getData());
+
+	// TinyGL has no stencil buffer. Overlapping shadow triangles are prevented
+	// from being blended several times by writing to the depth buffer instead.
+	// The shadow vertices all lie on the same plane, so only the first
+	// triangle drawn to a pixel passes the depth test.
+	tglEnable(TGL_BLEND);
+
+	tglColor4f(0.0f, 0.0f, 0.0f, 0.5f);
+
+	const Common::Array<Face *> &faces = _model->getFaces();
+	for (Common::Array<Face *>::const_iterator face = faces.begin(); face != faces.end(); ++face) {
+		tglBegin(TGL_TRIANGLES);
+		for (uint i = 0; i < (*face)->vertexIndices.size(); i++) {
+			const Math::Vector3d &modelPosition = _skinnedPositions[(*face)->vertexIndices[i]];
+
+			// Project the model position to the xz plane
+			Math::Vector3d shadowPosition = modelPosition + lightDirection * (-modelPosition.y() / lightDirection.y());
+
+			tglVertex3f(shadowPosition.x(), 0.0f, shadowPosition.z());
+		}
+		tglEnd();
+	}
+
+	tglDisable(TGL_BLEND);
+}
+
+} // End of namespace Gfx
+} // End of namespace Stark
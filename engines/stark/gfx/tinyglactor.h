@@ -0,0 +1,68 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef STARK_GFX_TINYGL_ACTOR_H
+#define STARK_GFX_TINYGL_ACTOR_H
+
+#include "engines/stark/gfx/renderentry.h"
+#include "engines/stark/gfx/tinygllights.h"
+#include "engines/stark/visual/actor.h"
+
+#include "common/array.h"
+
+#include "math/matrix3.h"
+#include "math/vector3d.h"
+
+namespace Stark {
+namespace Gfx {
+
+class TinyGLDriver;
+
+/**
+ * Actor renderer for the TinyGL driver
+ *
+ * TinyGL has no shaders, the skinning and the lighting done
+ * in the actor vertex shader are computed on the CPU instead.
+ */
+class TinyGLActorRenderer : public VisualActor {
+public:
+	explicit TinyGLActorRenderer(TinyGLDriver *gfx);
+	~TinyGLActorRenderer() override;
+
+	void render(const Math::Vector3d &position, float direction, const LightEntryArray &lights) override;
+
+protected:
+	TinyGLDriver *_gfx;
+	TinyGLLights _lights;
+
+	Common::Array<Math::Vector3d> _skinnedPositions;
+	Common::Array<Math::Vector3d> _vertexColors;
+
+	void skinVertices();
+	void shadeVertices(const Math::Matrix4 &modelView);
+	void renderShadow(const Math::Matrix4 &mvp, const Math::Vector3d &lightDirection);
+};
+
+} // End of namespace Gfx
+} // End of namespace Stark
+
+#endif // STARK_GFX_TINYGL_ACTOR_H
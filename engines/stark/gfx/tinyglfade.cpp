@@ -0,0 +1,64 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/stark/gfx/tinyglfade.h"
+
+#include "engines/stark/gfx/tinygl.h"
+
+namespace Stark {
+namespace Gfx {
+
+TinyGLFadeRenderer::TinyGLFadeRenderer(TinyGLDriver *gfx) :
+	FadeRenderer(),
+	_gfx(gfx) {
+}
+
+TinyGLFadeRenderer::~TinyGLFadeRenderer() {
+}
+
+void TinyGLFadeRenderer::render(float fadeLevel) {
+	_gfx->start2DMode();
+
+	tglMatrixMode(TGL_PROJECTION);
+	tglLoadIdentity();
+
+	tglMatrixMode(TGL_MODELVIEW);
+	tglLoadIdentity();
+
+	tglDisable(TGL_TEXTURE_2D);
+
+	// Black with premultiplied alpha, the blend function set by start2DMode
+	// scales the frame buffer by the fade level
+	tglColor4f(0.0f, 0.0f, 0.0f, 1.0f - fadeLevel);
+
+	tglBegin(TGL_TRIANGLE_STRIP);
+	tglVertex3f(-1.0f,  1.0f, 0.0f);
+	tglVertex3f( 1.0f,  1.0f, 0.0f);
+	tglVertex3f(-1.0f, -1.0f, 0.0f);
+	tglVertex3f( 1.0f, -1.0f, 0.0f);
+	tglEnd();
+
+	_gfx->end2DMode();
+}
+
+} // End of namespace Gfx
+} // End of namespace Stark
@@ -0,0 +1,122 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/stark/gfx/tinygllights.h"
+
+#include "math/vector4d.h"
+
+namespace Stark {
+namespace Gfx {
+
+void TinyGLLights::setLights(const LightEntryArray &lights, const Math::Matrix4 &viewMatrix) {
+	assert(lights.size() >= 1);
+
+	const LightEntry *ambient = lights[0];
+	assert(ambient->type == LightEntry::kAmbient); // The first light must be the ambient light
+	_ambientColor = ambient->color;
+
+	Math::Matrix3 viewMatrixRot = viewMatrix.getRotation();
+
+	_lights.resize(lights.size() - 1);
+	for (uint i = 0; i < lights.size() - 1; i++) {
+		const LightEntry *l = lights[i + 1];
+		EyeLight &light = _lights[i];
+
+		Math::Vector4d worldPosition;
+		worldPosition.x() = l->position.x();
+		worldPosition.y() = l->position.y();
+		worldPosition.z() = l->position.z();
+		worldPosition.w() = 1.0;
+
+		Math::Vector4d eyePosition = viewMatrix * worldPosition;
+
+		light.type = l->type;
+		light.position = Math::Vector3d(eyePosition.x(), eyePosition.y(), eyePosition.z());
+		light.direction = viewMatrixRot * l->direction;
+		light.direction.normalize();
+		light.color = l->color;
+		light.falloffNear = l->falloffNear;
+		light.falloffFar = l->falloffFar;
+		light.cosInnerAngle = l->innerConeAngle.getCosine();
+		light.cosOuterAngle = l->outerConeAngle.getCosine();
+	}
+}
+
+Math::Vector3d TinyGLLights::shade(const Math::Vector3d &eyePosition, const Math::Vector3d &eyeNormal) const {
+	Math::Vector3d lightColor = _ambientColor;
+
+	for (uint i = 0; i < _lights.size(); i++) {
+		const EyeLight &light = _lights[i];
+
+		switch (light.type) {
+		case LightEntry::kPoint:
+			lightColor += pointLight(light, eyePosition, eyeNormal);
+			break;
+		case LightEntry::kDirectional:
+			lightColor += directionalLight(light, eyeNormal);
+			break;
+		case LightEntry::kSpot:
+			lightColor += spotLight(light, eyePosition, eyeNormal);
+			break;
+		case LightEntry::kAmbient:
+		default:
+			break;
+		}
+	}
+
+	lightColor.x() = CLIP(lightColor.x(), 0.0f, 1.0f);
+	lightColor.y() = CLIP(lightColor.y(), 0.0f, 1.0f);
+	lightColor.z() = CLIP(lightColor.z(), 0.0f, 1.0f);
+
+	return lightColor;
+}
+
+Math::Vector3d TinyGLLights::pointLight(const EyeLight &light, const Math::Vector3d &eyePosition, const Math::Vector3d &eyeNormal) const {
+	Math::Vector3d vertexToLight = light.position - eyePosition;
+
+	float dist = vertexToLight.getMagnitude();
+	float attn = CLIP((light.falloffFar - dist) / MAX(0.001f, light.falloffFar - light.falloffNear), 0.0f, 1.0f);
+
+	vertexToLight.normalize();
+	float incidence = MAX(0.0f, eyeNormal.dotProduct(vertexToLight));
+
+	return light.color * attn * incidence;
+}
+
+Math::Vector3d TinyGLLights::directionalLight(const EyeLight &light, const Math::Vector3d &eyeNormal) const {
+	float incidence = MAX(0.0f, -eyeNormal.dotProduct(light.direction));
+
+	return light.color * incidence;
+}
+
+Math::Vector3d TinyGLLights::spotLight(const EyeLight &light, const Math::Vector3d &eyePosition, const Math::Vector3d &eyeNormal) const {
+	Math::Vector3d vertexToLight = light.position - eyePosition;
+	vertexToLight.normalize();
+
+	float cosAngle = MAX(0.0f, -vertexToLight.dotProduct(light.direction));
+	float cone = CLIP((cosAngle - light.cosInnerAngle) / MAX(0.001f, light.cosOuterAngle - light.cosInnerAngle), 0.0f, 1.0f);
+
+	return pointLight(light, eyePosition, eyeNormal) * cone;
+}
+
+} // End of namespace Gfx
+} // End of namespace Stark
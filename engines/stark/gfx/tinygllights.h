@@ -0,0 +1,73 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef STARK_GFX_TINYGL_LIGHTS_H
+#define STARK_GFX_TINYGL_LIGHTS_H
+
+#include "engines/stark/gfx/renderentry.h"
+
+#include "common/array.h"
+
+#include "math/matrix4.h"
+#include "math/vector3d.h"
+
+namespace Stark {
+namespace Gfx {
+
+/**
+ * Per vertex lighting computed on the CPU for the TinyGL renderers
+ *
+ * TinyGL's fixed function lighting does not match the light model of
+ * the game. The computations are the same as in the OpenGL shaders.
+ */
+class TinyGLLights {
+public:
+	/** Transform the lights to eye space */
+	void setLights(const LightEntryArray &lights, const Math::Matrix4 &viewMatrix);
+
+	/** Compute the light color received by a vertex in eye space */
+	Math::Vector3d shade(const Math::Vector3d &eyePosition, const Math::Vector3d &eyeNormal) const;
+
+private:
+	struct EyeLight {
+		LightEntry::Type type;
+		Math::Vector3d position;
+		Math::Vector3d direction;
+		Math::Vector3d color;
+		float falloffNear;
+		float falloffFar;
+		float cosInnerAngle;
+		float cosOuterAngle;
+	};
+
+	Math::Vector3d pointLight(const EyeLight &light, const Math::Vector3d &eyePosition, const Math::Vector3d &eyeNormal) const;
+	Math::Vector3d directionalLight(const EyeLight &light, const Math::Vector3d &eyeNormal) const;
+	Math::Vector3d spotLight(const EyeLight &light, const Math::Vector3d &eyePosition, const Math::Vector3d &eyeNormal) const;
+
+	Math::Vector3d _ambientColor;
+	Common::Array<EyeLight> _lights;
+};
+
+} // End of namespace Gfx
+} // End of namespace Stark
+
+#endif // STARK_GFX_TINYGL_LIGHTS_H
@@ -0,0 +1,126 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/stark/gfx/tinyglprop.h"
+
+#include "engines/stark/gfx/driver.h"
+#include "engines/stark/gfx/texture.h"
+#include "engines/stark/formats/biffmesh.h"
+#include "engines/stark/scene.h"
+#include "engines/stark/services/services.h"
+
+#include "graphics/tinygl/zgl.h"
+
+namespace Stark {
+namespace Gfx {
+
+TinyGLPropRenderer::TinyGLPropRenderer(Driver *gfx) :
+		VisualProp(),
+		_gfx(gfx) {
+}
+
+TinyGLPropRenderer::~TinyGLPropRenderer() {
+}
+
+void TinyGLPropRenderer::render(const Math::Vector3d &position, float direction, const LightEntryArray &lights) {
+	_gfx->set3DMode();
+
+	Math::Matrix4 model = getModelMatrix(position, direction);
+	Math::Matrix4 view = StarkScene->getViewMatrix();
+	Math::Matrix4 projection = StarkScene->getProjectionMatrix();
+
+	Math::Matrix4 modelViewMatrix = view * model;
+
+	_lights.setLights(lights, view);
+	shadeVertices(modelViewMatrix);
+
+	Math::Matrix4 projectionMatrix = projection;
+	projectionMatrix.transpose(); // TinyGL expects matrices transposed when compared to ResidualVM's
+
+	Math::Matrix4 glModelViewMatrix = modelViewMatrix;
+	glModelViewMatrix.transpose(); // TinyGL expects matrices transposed when compared to ResidualVM's
+
+	tglMatrixMode(TGL_PROJECTION);
+	tglLoadMatrixf(projectionMatrix.getData());
+
+	tglMatrixMode(TGL_MODELVIEW);
+	tglLoadMatrixf(glModelViewMatrix.getData());
+
+	const Common::Array<Formats::BiffMesh::Vertex> &vertices = _model->getVertices();
+	const Common::Array<Face> &faces = _model->getFaces();
+	const Common::Array<Material> &materials = _model->getMaterials();
+
+	for (Common::Array<Face>::const_iterator face = faces.begin(); face != faces.end(); ++face) {
+		const Material &material = materials[face->materialId];
+
+		const Gfx::Texture *tex = _texture->getTexture(material.texture);
+		if (tex) {
+			tglEnable(TGL_TEXTURE_2D);
+			tex->bind();
+		} else {
+			tglDisable(TGL_TEXTURE_2D);
+		}
+
+		Math::Vector3d color = tex ? Math::Vector3d(1.0f, 1.0f, 1.0f) : Math::Vector3d(material.r, material.g, material.b);
+
+		tglBegin(TGL_TRIANGLES);
+		for (uint i = 0; i < face->vertexIndices.size(); i++) {
+			uint32 index = face->vertexIndices[i];
+			const Formats::BiffMesh::Vertex &vertex = vertices[index];
+			const Math::Vector3d &light = _vertexColors[index];
+
+			float texS = vertex.texturePosition.x();
+			float texT = 1.0f - vertex.texturePosition.y();
+			if (!material.doubleSided) {
+				texS = 1.0f - texS;
+			}
+
+			tglColor4f(color.x() * light.x(), color.y() * light.y(), color.z() * light.z(), 1.0f);
+			tglTexCoord2f(texS, texT);
+			tglVertex3f(vertex.position.x(), vertex.position.y(), vertex.position.z());
+		}
+		tglEnd();
+	}
+
+	tglDisable(TGL_TEXTURE_2D);
+}
+
+void TinyGLPropRenderer::shadeVertices(const Math::Matrix4 &modelView) {
+	const Common::Array<Formats::BiffMesh::Vertex> &vertices = _model->getVertices();
+
+	Math::Matrix3 normalMatrix = modelView.getRotation();
+
+	_vertexColors.resize(vertices.size());
+
+	for (uint i = 0; i < vertices.size(); i++) {
+		Math::Vector3d eyeNormal = normalMatrix * vertices[i].normal;
+		eyeNormal.normalize();
+
+		Math::Vector3d eyePosition = vertices[i].position;
+		modelView.transform(&eyePosition, true);
+
+		_vertexColors[i] = _lights.shade(eyePosition, eyeNormal);
+	}
+}
+
+} // End of namespace Gfx
+} // End of namespace Stark
@@ -0,0 +1,62 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef STARK_GFX_TINYGL_RENDERED_H
+#define STARK_GFX_TINYGL_RENDERED_H
+
+#include "engines/stark/gfx/tinygllights.h"
+#include "engines/stark/model/model.h"
+#include "engines/stark/visual/prop.h"
+
+#include "common/array.h"
+
+namespace Stark {
+
+namespace Gfx {
+
+class Driver;
+
+/**
+ * Prop renderer for the TinyGL driver
+ *
+ * The lighting done in the prop vertex shader is computed on the CPU instead.
+ */
+class TinyGLPropRenderer : public VisualProp {
+public:
+	explicit TinyGLPropRenderer(Driver *gfx);
+	~TinyGLPropRenderer() override;
+
+	void render(const Math::Vector3d &position, float direction, const LightEntryArray &lights) override;
+
+protected:
+	Driver *_gfx;
+	TinyGLLights _lights;
+
+	Common::Array<Math::Vector3d> _vertexColors;
+
+	void shadeVertices(const Math::Matrix4 &modelView);
+};
+
+} // End of namespace Gfx
+} // End of namespace Stark
+
+#endif // STARK_GFX_TINYGL_RENDERED_H
@@ -0,0 +1,92 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/stark/gfx/tinyglsurface.h"
+
+#include "engines/stark/gfx/tinygl.h"
+#include "engines/stark/gfx/tinygltexture.h"
+
+#include "graphics/tinygl/zblit.h"
+
+namespace Stark {
+namespace Gfx {
+
+TinyGLSurfaceRenderer::TinyGLSurfaceRenderer(TinyGLDriver *gfx) :
+		SurfaceRenderer(),
+		_gfx(gfx) {
+}
+
+TinyGLSurfaceRenderer::~TinyGLSurfaceRenderer() {
+}
+
+void TinyGLSurfaceRenderer::render(const Texture *texture, const Common::Point &dest) {
+	render(texture, dest, texture->width(), texture->height());
+}
+
+void TinyGLSurfaceRenderer::render(const Texture *texture, const Common::Point &dest, uint width, uint height) {
+	// Blits are not affected by the viewport, compute the position in screen coordinates
+	Common::Rect viewport = _gfx->getViewport();
+	Common::Point position = scaleOriginalCoordinates(dest.x, dest.y);
+	position.x += viewport.left;
+	position.y += viewport.top;
+
+	Common::Point size;
+	if (_noScalingOverride) {
+		size = Common::Point(width, height);
+	} else {
+		size = scaleOriginalCoordinates(width, height);
+	}
+
+	if (size.x <= 0 || size.y <= 0) {
+		return;
+	}
+
+	const TinyGlTexture *glTexture = static_cast<const TinyGlTexture *>(texture);
+
+	Graphics::BlitTransform transform(position.x, position.y);
+	transform.sourceRectangle(0, 0, texture->width(), texture->height());
+	transform.scale(size.x, size.y);
+
+	if (_fadeLevel < 0) {
+		// The blitter can only multiply the colors, approximate the darkening
+		// by scaling the color channels. Brightening is not supported.
+		float colorScale = 1.0f + _fadeLevel;
+		transform.tint(1.0f, colorScale, colorScale, colorScale);
+	}
+
+	_gfx->start2DMode();
+	Graphics::tglBlit(glTexture->getBlitImage(), transform);
+	_gfx->end2DMode();
+}
+
+Common::Point TinyGLSurfaceRenderer::scaleOriginalCoordinates(int x, int y) const {
+	Common::Rect viewport = _gfx->getViewport();
+	Common::Rect unscaledViewport = _gfx->getUnscaledViewport();
+
+	return Common::Point(
+			x * viewport.width() / unscaledViewport.width(),
+			y * viewport.height() / unscaledViewport.height()
+	);
+}
+
+} // End of namespace Gfx
+} // End of namespace Stark
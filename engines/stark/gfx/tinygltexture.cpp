@@ -0,0 +1,176 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/stark/gfx/tinygltexture.h"
+
+#include "engines/stark/gfx/driver.h"
+
+#include "graphics/surface.h"
+
+namespace Stark {
+namespace Gfx {
+
+TinyGlTexture::TinyGlTexture() :
+	Texture(),
+	_id(0),
+	_levelCount(0),
+	_textureUpToDate(false),
+	_blitImageUpToDate(false) {
+	tglGenTextures(1, &_id);
+
+	tglBindTexture(TGL_TEXTURE_2D, _id);
+
+	tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_MIN_FILTER, TGL_NEAREST);
+	tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_MAG_FILTER, TGL_NEAREST);
+
+	// NOTE: TinyGL only supports repeating texture coordinates
+	tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_WRAP_S, TGL_REPEAT);
+	tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_WRAP_T, TGL_REPEAT);
+
+	_blitImage = Graphics::tglGenBlitImage();
+}
+
+TinyGlTexture::~TinyGlTexture() {
+	tglDeleteTextures(1, &_id);
+	Graphics::tglDeleteBlitImage(_blitImage);
+	_surface.free();
+}
+
+void TinyGlTexture::bind() const {
+	tglBindTexture(TGL_TEXTURE_2D, _id);
+
+	if (!_textureUpToDate && _surface.getPixels()) {
+		tglTexImage2D(TGL_TEXTURE_2D, 0, TGL_RGBA, _surface.w, _surface.h, 0, TGL_RGBA, TGL_UNSIGNED_BYTE, const_cast<void *>(_surface.getPixels()));
+		_textureUpToDate = true;
+	}
+}
+
+void TinyGlTexture::updateLevel(uint32 level, const Graphics::Surface *surface, const byte *palette) {
+	if (level != 0) {
+		// TinyGL does not support mipmapping, only the most detailed level is used
+		return;
+	}
+
+	_surface.free();
+
+	if (surface->format.bytesPerPixel != 4) {
+		// Convert the surface to texture format
+		Graphics::Surface *convertedSurface = surface->convertTo(Driver::getRGBAPixelFormat(), palette);
+		_surface = *convertedSurface;
+		delete convertedSurface;
+	} else {
+		assert(surface->format == Driver::getRGBAPixelFormat());
+		_surface.copyFrom(*surface);
+	}
+
+	_width = _surface.w;
+	_height = _surface.h;
+
+	// The texture and the blit image are uploaded when they are used
+	_textureUpToDate = false;
+	_blitImageUpToDate = false;
+}
+
+void TinyGlTexture::update(const Graphics::Surface *surface, const byte *palette) {
+	updateLevel(0, surface, palette);
+}
+
+void TinyGlTexture::updateArea(const Graphics::Surface *surface, const Common::Rect &area) {
+	assert(surface->format == Driver::getRGBAPixelFormat());
+	assert(surface->w == _width && surface->h == _height);
+
+	if (area.isEmpty()) {
+		return;
+	}
+
+	_surface.copyRectToSurface(*surface, area.left, area.top, area);
+
+	if (_textureUpToDate) {
+		// TinyGL resamples the textures to its own texture size. Include the neighbouring
+		// pixels so that all the texels interpolated from the updated area are refreshed.
+		Common::Rect textureArea = area;
+		textureArea.grow(1);
+		textureArea.clip(Common::Rect(_width, _height));
+
+		// The pixels of the area need to be contiguous
+		Graphics::Surface areaPixels;
+		areaPixels.copyFrom(surface->getSubArea(textureArea));
+
+		tglBindTexture(TGL_TEXTURE_2D, _id);
+		tglTexSubImage2D(TGL_TEXTURE_2D, 0, textureArea.left, textureArea.top, textureArea.width(), textureArea.height(),
+		                 TGL_RGBA, TGL_UNSIGNED_BYTE, areaPixels.getPixels());
+
+		areaPixels.free();
+	}
+
+	if (_blitImageUpToDate) {
+		Graphics::tglUpdateBlitImage(_blitImage, *surface, area, 0, false);
+	}
+}
+
+void TinyGlTexture::setSamplingFilter(Texture::SamplingFilter filter) {
+	assert(_levelCount == 0);
+
+	tglBindTexture(TGL_TEXTURE_2D, _id);
+
+	switch (filter) {
+	case kNearest:
+		tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_MIN_FILTER, TGL_NEAREST);
+		tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_MAG_FILTER, TGL_NEAREST);
+		break;
+	case kLinear:
+		tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_MIN_FILTER, TGL_LINEAR);
+		tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_MAG_FILTER, TGL_LINEAR);
+		break;
+	default:
+		warning("Unhandled sampling filter %d", filter);
+	}
+}
+
+void TinyGlTexture::setLevelCount(uint32 count) {
+	_levelCount = count;
+
+	if (count >= 1) {
+		tglBindTexture(TGL_TEXTURE_2D, _id);
+
+		tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_MIN_FILTER, TGL_LINEAR);
+		tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_MAG_FILTER, TGL_LINEAR);
+	}
+}
+
+void TinyGlTexture::addLevel(uint32 level, const Graphics::Surface *surface, const byte *palette) {
+	assert(level < _levelCount);
+
+	updateLevel(level, surface, palette);
+}
+
+Graphics::BlitImage *TinyGlTexture::getBlitImage() const {
+	if (!_blitImageUpToDate && _surface.getPixels()) {
+		Graphics::tglUploadBlitImage(_blitImage, _surface, 0, false);
+		_blitImageUpToDate = true;
+	}
+
+	return _blitImage;
+}
+
+} // End of namespace Gfx
+} // End of namespace Stark
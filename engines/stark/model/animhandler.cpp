@@ -71,22 +71,31 @@ void AnimHandler::setModel(Model *model) {
 	_model = model;
 }
 
-void AnimHandler::setNode(uint32 time, BoneNode *bone, const BoneNode *parent) {
+void AnimHandler::samplePoses(uint32 time) {
+	// Sample all the bones at once, so that the key frame lookups can
+	// resume from where they were the previous frame
+	_anim->getPose(time, _animPose, _animKeyCursors);
+
+	if (_blendTimeRemaining > 0) {
+		_blendAnim->getPose(_blendAnimTime, _blendAnimPose, _blendAnimKeyCursors);
+	}
+}
+
+void AnimHandler::setNode(BoneNode *bone, const BoneNode *parent) {
 	const Common::Array<BoneNode *> &bones = _model->getBones();
+	const SkeletonAnim::BoneCoords &animCoords = _animPose[bone->_idx];
 
 	if (_blendTimeRemaining <= 0) {
-		_anim->getCoordForBone(time, bone->_idx, bone->_animPos, bone->_animRot);
+		bone->_animPos = animCoords.position;
+		bone->_animRot = animCoords.rotation;
 	} else {
 		// Blend the coordinates of the previous and the current animation
-		Math::Vector3d previousAnimPos, animPos;
-		Math::Quaternion previousAnimRot, animRot;
-		_blendAnim->getCoordForBone(_blendAnimTime, bone->_idx, previousAnimPos, previousAnimRot);
-		_anim->getCoordForBone(time, bone->_idx, animPos, animRot);
+		const SkeletonAnim::BoneCoords &previousAnimCoords = _blendAnimPose[bone->_idx];
 
 		float blendingRatio = 1.0 - _blendTimeRemaining / (float)_blendDuration;
 
-		bone->_animPos = previousAnimPos + (animPos - previousAnimPos) * blendingRatio;
-		bone->_animRot = previousAnimRot.slerpQuat(animRot, blendingRatio);
+		bone->_animPos = previousAnimCoords.position + (animCoords.position - previousAnimCoords.position) * blendingRatio;
+		bone->_animRot = previousAnimCoords.rotation.slerpQuat(animCoords.rotation, blendingRatio);
 	}
 
 	if (parent) {
@@ -97,7 +106,7 @@ void AnimHandler::setNode(uint32 time, BoneNode *bone, const BoneNode *parent) {
 	}
 
 	for (uint i = 0; i < bone->_children.size(); ++i) {
-		setNode(time, bones[bone->_children[i]], bone);
+		setNode(bones[bone->_children[i]], bone);
 	}
 }
 
@@ -125,7 +134,8 @@ void AnimHandler::animate(uint32 time) {
 		// We need to animate here, because the model may have
 		// changed from under us.
 		const Common::Array<BoneNode *> &bones = _model->getBones();
-		setNode(_animTime, bones[0], nullptr);
+		samplePoses(_animTime);
+		setNode(bones[0], nullptr);
 		return;
 	}
 
@@ -150,7 +160,8 @@ void AnimHandler::animate(uint32 time) {
 
 	const Common::Array<BoneNode *> &bones = _model->getBones();
 	if (deltaTime >= 0) {
-		setNode(time, bones[0], nullptr);
+		samplePoses(time);
+		setNode(bones[0], nullptr);
 		_animTime = time;
 	}
 }
@@ -167,6 +178,9 @@ void AnimHandler::startBlending() {
 	_blendTimeRemaining = _blendDuration;
 	_blendAnim = _anim;
 	_blendAnimTime = _animTime;
+
+	// The key cursors follow the animation they were used with
+	SWAP(_blendAnimKeyCursors, _animKeyCursors);
 }
 
 void AnimHandler::updateBlending(int32 deltaTime) {
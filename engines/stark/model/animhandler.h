@@ -23,13 +23,14 @@
 #ifndef STARK_MODEL_ANIM_HANDLER_H
 #define STARK_MODEL_ANIM_HANDLER_H
 
+#include "engines/stark/model/skeleton_anim.h"
+
 #include "common/scummsys.h"
 
 namespace Stark {
 
 class Model;
 class BoneNode;
-class SkeletonAnim;
 
 /**
  * Animate a skeletal model's bones according to an animation
@@ -59,7 +60,8 @@ private:
 	void updateBlending(int32 deltaTime);
 	void stopBlending();
 
-	void setNode(uint32 time, BoneNode *bone, const BoneNode *parent);
+	void samplePoses(uint32 time);
+	void setNode(BoneNode *bone, const BoneNode *parent);
 
 	static const uint32 _blendDuration = 300; // ms
 
@@ -75,6 +77,11 @@ private:
 	int32 _blendTimeRemaining;
 
 	Model *_model;
+
+	SkeletonAnim::Pose _animPose;
+	SkeletonAnim::KeyCursors _animKeyCursors;
+	SkeletonAnim::Pose _blendAnimPose;
+	SkeletonAnim::KeyCursors _blendAnimKeyCursors;
 };
 
 } // End of namespace Stark
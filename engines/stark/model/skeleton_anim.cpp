@@ -22,8 +22,11 @@
 
 #include "engines/stark/model/skeleton_anim.h"
 
+#include "engines/stark/debug.h"
 #include "engines/stark/services/archiveloader.h"
 
+#include "common/debug.h"
+
 namespace Stark {
 
 SkeletonAnim::SkeletonAnim() :
@@ -68,8 +71,56 @@ void SkeletonAnim::createFromStream(ArchiveReadStream *stream) {
 }
 
 void SkeletonAnim::getCoordForBone(uint32 time, int boneIdx, Math::Vector3d &pos, Math::Quaternion &rot) const {
+	uint32 cursor = 0;
+	sampleBone(time, boneIdx, cursor, pos, rot);
+}
+
+void SkeletonAnim::getPose(uint32 time, Pose &pose, KeyCursors &cursors) const {
+	pose.resize(_boneAnims.size());
+	cursors.resize(_boneAnims.size());
+
+	for (uint32 i = 0; i < _boneAnims.size(); i++) {
+		sampleBone(time, i, cursors[i], pose[i].position, pose[i].rotation);
+	}
+}
+
+uint32 SkeletonAnim::findKey(const Common::Array<AnimKey> &keys, uint32 time, uint32 cursor) {
+	// Find the first key frame at or after the requested time
+
+	// Try to resume from the key found the previous time,
+	// looking at a few keys forward since time usually only advances by one frame
+	static const uint32 maxForwardSteps = 4;
+	if (cursor <= keys.size() && (cursor == 0 || keys[cursor - 1]._time < time)) {
+		for (uint32 step = 0; step < maxForwardSteps; step++) {
+			if (cursor == keys.size() || keys[cursor]._time >= time) {
+				return cursor;
+			}
+			cursor++;
+		}
+	}
+
+	// Seeking, fallback to a binary search
+	uint32 first = 0;
+	uint32 last = keys.size();
+	while (first < last) {
+		uint32 middle = first + (last - first) / 2;
+		if (keys[middle]._time < time) {
+			first = middle + 1;
+		} else {
+			last = middle;
+		}
+	}
+
+	return first;
+}
+
+void SkeletonAnim::sampleBone(uint32 time, uint32 boneIdx, uint32 &cursor, Math::Vector3d &pos, Math::Quaternion &rot) const {
 	const Common::Array<AnimKey> &keys = _boneAnims[boneIdx]._keys;
 
+	if (keys.empty()) {
+		return;
+	}
+
 	if (keys.size() == 1) {
 		// There is only one key for this bone, don't bother searching which one to use
 		pos = keys[0]._pos;
@@ -78,31 +129,33 @@ void SkeletonAnim::getCoordForBone(uint32 time, int boneIdx, Math::Vector3d &pos
 		return;
 	}
 
-	for (Common::Array<AnimKey>::const_iterator it = keys.begin(); it < keys.end(); ++it) {
-		if (it->_time > time) {
-			// Between two key frames, interpolate
-			const AnimKey *a = it;
-			--it;
-			const AnimKey *b = it;
-
-			float t = (float)(time - b->_time) / (float)(a->_time - b->_time);
-
-			pos = b->_pos + (a->_pos - b->_pos) * t;
-			rot = b->_rot.slerpQuat(a->_rot, t);
-
-			return;
-		} else if (it->_time == time || it == keys.end() - 1){
-			// At a key frame
-			// If not right one but didn't find any, then use last one as default
-			const AnimKey *key = it;
-			pos = key->_pos;
-			rot = key->_rot;
-			if (it == keys.end() - 1) {
-				warning("Unable to find keyframe for bone '%d' at %d ms, using default", boneIdx, time);
-			}
-			return;
-		}
+	cursor = findKey(keys, time, cursor);
+
+	if (cursor == keys.size()) {
+		// Past the last key frame, use it as default
+		const AnimKey &key = keys.back();
+		pos = key._pos;
+		rot = key._rot;
+
+		debugC(kDebugAnimation, "Unable to find keyframe for bone '%d' at %d ms, using default", boneIdx, time);
+		return;
+	}
+
+	const AnimKey &a = keys[cursor];
+	if (a._time == time || cursor == 0) {
+		// At a key frame
+		pos = a._pos;
+		rot = a._rot;
+		return;
 	}
+
+	// Between two key frames, interpolate
+	const AnimKey &b = keys[cursor - 1];
+
+	float t = (float)(time - b._time) / (float)(a._time - b._time);
+
+	pos = b._pos + (a._pos - b._pos) * t;
+	rot = b._rot.slerpQuat(a._rot, t);
 }
 
 } // End of namespace Stark
@@ -36,6 +36,22 @@ class ArchiveReadStream;
  */
 class SkeletonAnim {
 public:
+	/** The animated coordinates of a bone, relative to its parent */
+	struct BoneCoords {
+		Math::Vector3d position;
+		Math::Quaternion rotation;
+	};
+
+	typedef Common::Array<BoneCoords> Pose;
+
+	/**
+	 * Per bone position in the key frame lists, from the previous lookup
+	 *
+	 * Animations are usually played forward, which means the key frames
+	 * needed for a lookup are at or right after the ones used the previous time.
+	 */
+	typedef Common::Array<uint32> KeyCursors;
+
 	SkeletonAnim();
 
 	void createFromStream(ArchiveReadStream *stream);
@@ -45,6 +61,15 @@ public:
 	 */
 	void getCoordForBone(uint32 time, int boneIdx, Math::Vector3d &pos, Math::Quaternion &rot) const;
 
+	/**
+	 * Get the interpolated coordinates of all the bones at a given animation timestamp
+	 *
+	 * The key cursors are used as a hint to speed up the key frame lookup, and updated
+	 * for the next call. They can be shared with any other animation, but lookups are
+	 * only fast when the cursors were last used with this animation at an earlier time.
+	 */
+	void getPose(uint32 time, Pose &pose, KeyCursors &cursors) const;
+
 	/**
 	 * Get total animation length (in ms)
 	 */
@@ -64,6 +89,9 @@ private:
 		Common::Array<AnimKey> _keys;
 	};
 
+	static uint32 findKey(const Common::Array<AnimKey> &keys, uint32 time, uint32 cursor);
+	void sampleBone(uint32 time, uint32 boneIdx, uint32 &cursor, Math::Vector3d &pos, Math::Quaternion &rot) const;
+
 	uint32 _id, _ver, _u1, _u2, _time;
 
 	Common::Array<BoneAnim> _boneAnims;
@@ -11,9 +11,17 @@ MODULE_OBJS := \
 	gfx/openglsprop.o \
 	gfx/openglssurface.o \
 	gfx/opengltexture.o \
+	gfx/pickinggrid.o \
 	gfx/renderentry.o \
 	gfx/surfacerenderer.o \
 	gfx/texture.o \
+	gfx/tinygl.o \
+	gfx/tinyglactor.o \
+	gfx/tinyglfade.o \
+	gfx/tinygllights.o \
+	gfx/tinyglprop.o \
+	gfx/tinyglsurface.o \
+	gfx/tinygltexture.o \
 	formats/biff.o \
 	formats/biffmesh.o \
 	formats/dds.o \
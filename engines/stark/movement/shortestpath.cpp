@@ -22,80 +22,144 @@
 
 #include "engines/stark/movement/shortestpath.h"
 
-#include "common/hash-ptr.h"
-
 #include "engines/stark/resources/floor.h"
 
+#include "common/math.h"
+
 namespace Stark {
 
-ShortestPath::NodeList ShortestPath::search(const Resources::FloorEdge *start, const Resources::FloorEdge *goal) {
-	NodeList frontier;
-	NodePrecedenceMap cameFrom;
-	NodeCostMap costSoFar;
+ShortestPath::NodeList ShortestPath::search(const Resources::Floor *floor, const Resources::FloorEdge *start, const Resources::FloorEdge *goal) {
+	uint32 edgeCount = floor->getEdgeCount();
 
-	frontier.push_back(start);
-	cameFrom[start] = nullptr;
-	costSoFar[start] = 0;
+	_heap.clear();
+	_heapPosition.resize(edgeCount);
+	_costSoFar.resize(edgeCount);
+	_estimatedCost.resize(edgeCount);
+	_cameFrom.resize(edgeCount);
+
+	for (uint32 i = 0; i < edgeCount; i++) {
+		_heapPosition[i] = -1;
+		_costSoFar[i] = FLT_MAX;
+		_cameFrom[i] = -1;
+	}
 
-	while (!frontier.empty()) {
-		const Resources::FloorEdge *current = popEdgeWithLowestCost(frontier, costSoFar);
+	uint32 startIndex = start->getIndex();
+	uint32 goalIndex = goal->getIndex();
+	Math::Vector3d goalPosition = goal->getPosition();
 
-		if (current == goal)
+	_costSoFar[startIndex] = 0;
+	_estimatedCost[startIndex] = start->getPosition().getDistanceTo(goalPosition);
+	heapPush(startIndex);
+
+	while (!_heap.empty()) {
+		uint32 current = heapPop();
+
+		if (current == goalIndex)
 			break;
 
-		Common::Array<Resources::FloorEdge *> neighbours = current->getNeighbours();
-		for (uint i = 0; i < neighbours.size(); i++) {
-			const Resources::FloorEdge *next = neighbours[i];
-			if (!next->isEnabled())
+		uint32 neighbourCount;
+		const Resources::FloorEdgeNeighbour *neighbours = floor->getEdgeNeighbours(current, neighbourCount);
+		for (uint32 i = 0; i < neighbourCount; i++) {
+			uint32 next = neighbours[i].edgeIndex;
+			const Resources::FloorEdge *nextEdge = floor->getEdge(next);
+			if (!nextEdge->isEnabled())
 				continue;
 
-			float newCost = costSoFar[current] + current->costTo(next);
-			if (!costSoFar.contains(next) || newCost < costSoFar[next]) {
-				frontier.push_back(next);
-				cameFrom[next] = current;
-				costSoFar[next] = newCost;
+			float newCost = _costSoFar[current] + neighbours[i].cost;
+			if (newCost < _costSoFar[next]) {
+				_cameFrom[next] = current;
+				_costSoFar[next] = newCost;
+				_estimatedCost[next] = newCost + nextEdge->getPosition().getDistanceTo(goalPosition);
+
+				if (_heapPosition[next] < 0) {
+					heapPush(next);
+				} else {
+					heapSiftUp(_heapPosition[next]);
+				}
 			}
 		}
 	}
 
-	return rebuildPath(start, goal, cameFrom);
+	return rebuildPath(floor, startIndex, goalIndex);
 }
 
-ShortestPath::NodeList ShortestPath::rebuildPath(const Resources::FloorEdge *start, const Resources::FloorEdge *goal,
-                                                 const NodePrecedenceMap &cameFrom) const {
+ShortestPath::NodeList ShortestPath::rebuildPath(const Resources::Floor *floor, uint32 start, uint32 goal) const {
 	NodeList path;
 
-	const Resources::FloorEdge *current = goal;
-	path.push_front(goal);
+	int32 current = goal;
+	path.push_front(floor->getEdge(goal));
 
-	while (current && current != start) {
-		current = cameFrom[current];
-		path.push_front(current);
+	while (current >= 0 && current != (int32)start) {
+		current = _cameFrom[current];
+		if (current >= 0) {
+			path.push_front(floor->getEdge(current));
+		}
 	}
 
-	if (current != start) {
+	if (current != (int32)start) {
 		// No path has been found from start to goal
 		return NodeList();
 	}
 
-	path.push_front(start);
+	path.push_front(floor->getEdge(start));
 	return path;
 }
 
-const Resources::FloorEdge *ShortestPath::popEdgeWithLowestCost(NodeList &frontier, const NodeCostMap &costSoFar) const {
-	// Poor man's priority queue using a list ...
-	NodeList::iterator lowestCostItem = frontier.begin();
-	for (NodeList::iterator it = frontier.begin(); it != frontier.end(); it++) {
-		if (costSoFar[*it] < costSoFar[*lowestCostItem]) {
-			lowestCostItem = it;
-		}
-	}
+void ShortestPath::heapPush(uint32 edge) {
+	_heap.push_back(edge);
+	_heapPosition[edge] = _heap.size() - 1;
+	heapSiftUp(_heap.size() - 1);
+}
 
-	const Resources::FloorEdge *result = *lowestCostItem;
+uint32 ShortestPath::heapPop() {
+	uint32 result = _heap[0];
 
-	frontier.erase(lowestCostItem);
+	heapSwap(0, _heap.size() - 1);
+	_heap.pop_back();
+	_heapPosition[result] = -1;
+
+	if (!_heap.empty()) {
+		heapSiftDown(0);
+	}
 
 	return result;
 }
 
+void ShortestPath::heapSiftUp(uint32 position) {
+	while (position > 0) {
+		uint32 parent = (position - 1) / 2;
+		if (_estimatedCost[_heap[parent]] <= _estimatedCost[_heap[position]])
+			break;
+
+		heapSwap(parent, position);
+		position = parent;
+	}
+}
+
+void ShortestPath::heapSiftDown(uint32 position) {
+	uint32 size = _heap.size();
+	while (true) {
+		uint32 smallest = position;
+		uint32 left = 2 * position + 1;
+		uint32 right = left + 1;
+
+		if (left < size && _estimatedCost[_heap[left]] < _estimatedCost[_heap[smallest]])
+			smallest = left;
+		if (right < size && _estimatedCost[_heap[right]] < _estimatedCost[_heap[smallest]])
+			smallest = right;
+
+		if (smallest == position)
+			break;
+
+		heapSwap(smallest, position);
+		position = smallest;
+	}
+}
+
+void ShortestPath::heapSwap(uint32 position1, uint32 position2) {
+	SWAP(_heap[position1], _heap[position2]);
+	_heapPosition[_heap[position1]] = position1;
+	_heapPosition[_heap[position2]] = position2;
+}
+
 } // End of namespace Stark
@@ -23,35 +23,46 @@
 #ifndef STARK_MOVEMENT_SHORTEST_PATH_H
 #define STARK_MOVEMENT_SHORTEST_PATH_H
 
+#include "common/array.h"
 #include "common/list.h"
-#include "common/hashmap.h"
 
 namespace Stark {
 
 namespace Resources {
+class Floor;
 class FloorEdge;
 }
 
 /**
- * Find the shortest path between two nodes in a graph
+ * Find the shortest path between two edges of a floor
  *
- * This is an implementation of Dijsktra's search algorithm
+ * This is an implementation of the A* search algorithm, using the straight
+ * line distance to the goal as the heuristic. The search state is stored
+ * in arrays indexed by edge, which are reused by the subsequent searches.
  */
 class ShortestPath {
 public:
 	typedef Common::List<const Resources::FloorEdge *> NodeList;
 
-	/** Computes the shortest path between the start and the goal graph nodes */
-	NodeList search(const Resources::FloorEdge *start, const Resources::FloorEdge *goal);
+	/** Computes the shortest path between the start and the goal floor edges */
+	NodeList search(const Resources::Floor *floor, const Resources::FloorEdge *start, const Resources::FloorEdge *goal);
 
 private:
-	typedef Common::HashMap<const Resources::FloorEdge *, const Resources::FloorEdge *> NodePrecedenceMap;
-	typedef Common::HashMap<const Resources::FloorEdge *, float> NodeCostMap;
+	NodeList rebuildPath(const Resources::Floor *floor, uint32 start, uint32 goal) const;
 
-	const Resources::FloorEdge *popEdgeWithLowestCost(NodeList &frontier, const NodeCostMap &costSoFar) const;
+	// Indexed binary min-heap of the edges to visit, ordered by estimated total cost
+	void heapPush(uint32 edge);
+	uint32 heapPop();
+	void heapSiftUp(uint32 position);
+	void heapSiftDown(uint32 position);
+	void heapSwap(uint32 position1, uint32 position2);
 
-	NodeList rebuildPath(const Resources::FloorEdge *start, const Resources::FloorEdge *goal,
-	                                    const NodePrecedenceMap &cameFrom) const;
+	Common::Array<uint32> _heap;
+	Common::Array<int32> _heapPosition; // Position of each edge in the heap, -1 when not in the heap
+
+	Common::Array<float> _costSoFar;
+	Common::Array<float> _estimatedCost;
+	Common::Array<int32> _cameFrom;
 };
 
 } // End of namespace Stark
@@ -81,7 +81,7 @@ void Walk::stop(bool force) {
 	}
 }
 
-void Walk::updatePath() const {
+void Walk::updatePath() {
 	_path->reset();
 
 	Resources::Floor *floor = StarkGlobal->getCurrent()->getFloor();
@@ -112,8 +112,7 @@ void Walk::updatePath() const {
 		return;
 	}
 
-	ShortestPath pathSearch;
-	ShortestPath::NodeList edgePath = pathSearch.search(startFloorEdge, destinationFloorEdge);
+	ShortestPath::NodeList edgePath = _pathSearch.search(floor, startFloorEdge, destinationFloorEdge);
 
 	for (ShortestPath::NodeList::const_iterator it = edgePath.begin(); it != edgePath.end(); it++) {
 		_path->addStep((*it)->getPosition());
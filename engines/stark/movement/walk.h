@@ -24,6 +24,7 @@
 #define STARK_MOVEMENT_WALK_H
 
 #include "engines/stark/movement/movement.h"
+#include "engines/stark/movement/shortestpath.h"
 
 #include "common/array.h"
 
@@ -71,7 +72,7 @@ private:
 	float getAngularSpeed() const;
 
 	void changeItemAnim();
-	void updatePath() const;
+	void updatePath();
 
 	void queueDestinationToAvoidItem(Resources::FloorPositionedItem *item, const Math::Vector3d &destination);
 	bool isItemAlreadyAvoided(Resources::FloorPositionedItem *item) const;
@@ -80,6 +81,7 @@ private:
 
 	Resources::FloorPositionedItem *_item3D;
 	StringPullingPath *_path;
+	ShortestPath _pathSearch;
 
 	Math::Vector3d _destination;
 	Common::Array<Math::Vector3d> _destinations;
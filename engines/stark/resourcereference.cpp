@@ -41,14 +41,56 @@ Common::String ResourceReference::PathElement::describe() const {
 	return  Common::String::format("(%s idx %d)", _type.getName(), _index);
 }
 
-ResourceReference::ResourceReference() {
+// Generation zero is never current, it marks references that have not been resolved
+uint32 ResourceReference::_generation = 1;
+ResourceReference::ResolveStats ResourceReference::_stats = { 0, 0, 0 };
+
+ResourceReference::ResourceReference() :
+		_resolvedResource(nullptr),
+		_resolvedGeneration(0) {
 }
 
 void ResourceReference::addPathElement(Resources::Type type, uint16 index) {
 	_path.push_back(PathElement(type, index));
+	_resolvedGeneration = 0;
+}
+
+void ResourceReference::invalidateResolvedResources() {
+	_generation++;
+
+	if (_generation == 0) {
+		_generation = 1;
+	}
+}
+
+ResourceReference::ResolveStats ResourceReference::getResolveStats() {
+	return _stats;
+}
+
+void ResourceReference::resetResolveStats() {
+	_stats.frames = 0;
+	_stats.resolves = 0;
+	_stats.treeWalks = 0;
+}
+
+void ResourceReference::countResolveStatsFrame() {
+	_stats.frames++;
 }
 
 Resources::Object *ResourceReference::resolve() const {
+	_stats.resolves++;
+
+	if (_resolvedGeneration != _generation) {
+		_resolvedResource = walkPath();
+		_resolvedGeneration = _generation;
+	}
+
+	return _resolvedResource;
+}
+
+Resources::Object *ResourceReference::walkPath() const {
+	_stats.treeWalks++;
+
 	Resources::Object *level = nullptr;
 	Resources::Object *resource = nullptr;
 	for (uint i = 0; i < _path.size(); i++) {
@@ -179,10 +221,13 @@ void ResourceReference::buildFromResource(Resources::Object *resource) {
 	for (int i = reversePath.size() - 1; i >= 0; i--) {
 		_path.push_back(reversePath[i]);
 	}
+
+	_resolvedGeneration = 0;
 }
 
 void ResourceReference::loadFromStream(Common::ReadStream *stream) {
 	_path.clear();
+	_resolvedGeneration = 0;
 
 	uint32 pathSize = stream->readUint32LE();
 	for (uint i = 0; i < pathSize; i++) {
@@ -61,9 +61,32 @@ public:
 
 	/** Can this reference be resolved using currently loaded archives? */
 	bool canResolve() const;
+
+	/**
+	 * Forget the resources resolved by all the references
+	 *
+	 * Must be called when the resource trees are loaded or unloaded,
+	 * or when the current level or location changes.
+	 */
+	static void invalidateResolvedResources();
+
+	/** Resolution counters, used to measure the efficiency of the resolved resource cache */
+	struct ResolveStats {
+		uint32 frames;     /**< Number of frames since the last reset */
+		uint32 resolves;   /**< Number of resolve calls since the last reset */
+		uint32 treeWalks;  /**< Number of resolve calls that had to walk the resource trees */
+	};
+
+	static ResolveStats getResolveStats();
+	static void resetResolveStats();
+
+	/** Count a frame for the resolution counters */
+	static void countResolveStatsFrame();
+
 private:
 	void addPathElement(Resources::Type type, uint16 index);
 	Resources::Object *resolve() const;
+	Resources::Object *walkPath() const;
 
 	class PathElement {
 	public:
@@ -79,6 +102,13 @@ private:
 	};
 
 	Common::Array<PathElement> _path;
+
+	// The last resolved resource is kept until the resource trees change
+	mutable Resources::Object *_resolvedResource;
+	mutable uint32 _resolvedGeneration;
+
+	static uint32 _generation;
+	static ResolveStats _stats;
 };
 
 template<class T>
@@ -404,6 +404,9 @@ Command *Command::opFadeScene(Script *script, bool fadeOut, int32 fadeDuration,
 	Location *location = current->getLocation();
 	if (fadeOut) {
 		location->fadeOutInit(fadeDuration);
+
+		// Fading out the scene usually precedes a location change
+		preloadNextLocation();
 	} else {
 		location->fadeInInit(fadeDuration);
 	}
@@ -416,6 +419,32 @@ Command *Command::opFadeScene(Script *script, bool fadeOut, int32 fadeDuration,
 	}
 }
 
+void Command::preloadNextLocation() {
+	static const uint maxLookAhead = 8;
+
+	Command *command = this;
+	for (uint i = 0; i < maxLookAhead; i++) {
+		// Follow the default branch of the commands, the location change is usually unconditional
+		if (command->_subType == kCommandEnd
+		        || command->_arguments.empty()
+		        || command->_arguments[0].type != Argument::kTypeInteger1) {
+			return;
+		}
+
+		command = command->nextCommand();
+		if (!command) {
+			return;
+		}
+
+		if (command->_subType == kLocationGoTo || command->_subType == kLocationGoToNewCD) {
+			uint levelIndex = strtol(command->_arguments[0].stringValue.c_str(), nullptr, 16);
+			uint locationIndex = strtol(command->_arguments[1].stringValue.c_str(), nullptr, 16);
+			StarkResourceProvider->requestLocationPreload(levelIndex, locationIndex);
+			return;
+		}
+	}
+}
+
 Command *Command::opSwayScene(int32 periodMs, int32 angleIn, int32 amplitudeIn, int32 offsetIn) {
 	Math::Angle angle = ABS(angleIn) % 360;
 	float amplitude = amplitudeIn / 100.0f;
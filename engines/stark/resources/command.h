@@ -203,6 +203,9 @@ protected:
 
 	Math::Vector3d getObjectPosition(const ResourceReference &targetRef, int32 *floorFace = nullptr);
 
+	/** Look a few commands ahead for a location change, and ask for the location to be preloaded */
+	void preloadNextLocation();
+
 	Command *opScriptBegin();
 	Command *opScriptCall(Script *script, const ResourceReference &scriptRef, int32 synchronous);
 	Command *opDialogCall(Script *script, const ResourceReference &dialogRef, int32 suspend);
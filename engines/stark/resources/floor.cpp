@@ -29,11 +29,31 @@
 
 #include "engines/stark/services/stateprovider.h"
 
+#include "common/algorithm.h"
 #include "common/math.h"
 
 namespace Stark {
 namespace Resources {
 
+static const uint32 kFaceTreeLeafSize = 4;
+static const uint32 kFaceTreeMaxDepth = 32;
+static const float kFaceTreeMargin = 0.1f;
+
+/** Orders floor faces along an axis using their centers */
+struct FaceCenterComparator {
+	FaceCenterComparator(const Common::Array<FloorFace *> &faces, uint32 axis) :
+			_faces(faces),
+			_axis(axis) {
+	}
+
+	bool operator()(uint32 face1, uint32 face2) const {
+		return _faces[face1]->getCenter().getValue(_axis) < _faces[face2]->getCenter().getValue(_axis);
+	}
+
+	const Common::Array<FloorFace *> &_faces;
+	uint32 _axis;
+};
+
 Floor::Floor(Object *parent, byte subType, uint16 index, const Common::String &name) :
 		Object(parent, subType, index, name),
 		_facesCount(0) {
@@ -48,13 +68,42 @@ Math::Vector3d Floor::getVertex(uint32 index) const {
 }
 
 int32 Floor::findFaceContainingPoint(const Math::Vector3d &point) const {
-	for (uint32 i = 0; i < _faces.size(); i++) {
-		if (_faces[i]->hasVertices() && _faces[i]->isPointInside(point)) {
-			return i;
+	if (_faceTreeNodes.empty()) {
+		return -1;
+	}
+
+	int32 result = -1;
+
+	uint32 stack[kFaceTreeMaxDepth];
+	uint32 stackSize = 0;
+	stack[stackSize++] = 0;
+
+	while (stackSize > 0) {
+		const FaceTreeNode &node = _faceTreeNodes[stack[--stackSize]];
+
+		if (result >= 0 && node.minFaceIndex >= (uint32)result) {
+			continue; // A face with a lower index has already been found
+		}
+
+		// The faces are projected on a Z=0 plane
+		if (point.x() < node.min.x() || point.x() > node.max.x()
+		        || point.y() < node.min.y() || point.y() > node.max.y()) {
+			continue;
+		}
+
+		if (node.children[0] < 0) {
+			for (uint32 i = node.firstFace; i < node.firstFace + node.faceCount; i++) {
+				int32 faceIndex = _faceTreeFaces[i];
+				if ((result < 0 || faceIndex < result) && _faces[faceIndex]->isPointInside(point)) {
+					result = faceIndex;
+				}
+			}
+		} else {
+			pushFaceTreeChildrenByIndex(node, stack, stackSize);
 		}
 	}
 
-	return -1;
+	return result;
 }
 
 void Floor::computePointHeightInFace(Math::Vector3d &point, uint32 faceIndex) const {
@@ -62,30 +111,95 @@ void Floor::computePointHeightInFace(Math::Vector3d &point, uint32 faceIndex) co
 }
 
 int32 Floor::findFaceHitByRay(const Math::Ray &ray, Math::Vector3d &intersection) const {
-	for (uint32 i = 0; i < _faces.size(); i++) {
-		// TODO: Check the ray's intersection with an AABB first if this ends up being slow
-		if (_faces[i]->intersectRay(ray, intersection)) {
-			if (_faces[i]->isEnabled()) {
-				return i;
-			} else {
-				return -1; // Disabled faces block the ray
+	if (_faceTreeNodes.empty()) {
+		return -1;
+	}
+
+	int32 result = -1;
+
+	uint32 stack[kFaceTreeMaxDepth];
+	uint32 stackSize = 0;
+	stack[stackSize++] = 0;
+
+	while (stackSize > 0) {
+		const FaceTreeNode &node = _faceTreeNodes[stack[--stackSize]];
+
+		if (result >= 0 && node.minFaceIndex >= (uint32)result) {
+			continue; // A face with a lower index has already been found
+		}
+
+		if (!rayIntersectsBox(ray, node.min, node.max)) {
+			continue;
+		}
+
+		if (node.children[0] < 0) {
+			for (uint32 i = node.firstFace; i < node.firstFace + node.faceCount; i++) {
+				int32 faceIndex = _faceTreeFaces[i];
+				Math::Vector3d faceIntersection;
+				if ((result < 0 || faceIndex < result) && _faces[faceIndex]->intersectRay(ray, faceIntersection)) {
+					result = faceIndex;
+					intersection = faceIntersection;
+				}
 			}
+		} else {
+			pushFaceTreeChildrenByIndex(node, stack, stackSize);
 		}
 	}
 
-	return -1;
+	if (result >= 0 && !_faces[result]->isEnabled()) {
+		return -1; // Disabled faces block the ray
+	}
+
+	return result;
 }
 
 int32 Floor::findFaceClosestToRay(const Math::Ray &ray, Math::Vector3d &center) const {
+	if (_faceTreeNodes.empty()) {
+		return -1;
+	}
+
 	float minDistance = FLT_MAX;
 	int32 minFace = -1;
 
-	// For some reason, face 0 is not being considered
-	for (uint32 i = 1; i < _faces.size(); i++) {
-		if (_faces[i]->isEnabled() && _faces[i]->hasVertices()) {
-			float distance = _faces[i]->distanceToRay(ray);
-			if (distance < minDistance) {
-				minFace = i;
+	Math::Vector3d rayOrigin = ray.getOrigin();
+	Math::Vector3d rayDirection = ray.getDirection();
+	float rayDirectionLength = rayDirection.getMagnitude();
+
+	uint32 stack[kFaceTreeMaxDepth];
+	uint32 stackSize = 0;
+	stack[stackSize++] = 0;
+
+	while (stackSize > 0) {
+		const FaceTreeNode &node = _faceTreeNodes[stack[--stackSize]];
+
+		// Lower bound of the distance between the ray and the face centers in the node,
+		// using the node's bounding sphere, with the same scale as FloorFace::distanceToRay
+		Math::Vector3d nodeCenter = (node.min + node.max) / 2.0;
+		float nodeRadius = (node.max - node.min).getMagnitude() / 2.0;
+		float nodeDistance = Math::Vector3d::crossProduct(rayDirection, nodeCenter - rayOrigin).getMagnitude()
+		        - nodeRadius * rayDirectionLength;
+		if (nodeDistance > minDistance) {
+			continue;
+		}
+
+		if (node.children[0] >= 0) {
+			stack[stackSize++] = node.children[0];
+			stack[stackSize++] = node.children[1];
+			continue;
+		}
+
+		for (uint32 i = node.firstFace; i < node.firstFace + node.faceCount; i++) {
+			int32 faceIndex = _faceTreeFaces[i];
+
+			// For some reason, face 0 is not being considered
+			if (faceIndex == 0 || !_faces[faceIndex]->isEnabled()) {
+				continue;
+			}
+
+			// Keep the face with the lowest index when distances are equal, as the original
+			float distance = _faces[faceIndex]->distanceToRay(ray);
+			if (distance < minDistance || (distance == minDistance && faceIndex < minFace)) {
+				minFace = faceIndex;
 				minDistance = distance;
 			}
 		}
@@ -148,6 +262,7 @@ void Floor::onAllLoaded() {
 	_faces = listChildren<FloorFace>();
 
 	buildEdgeList();
+	buildFaceTree();
 }
 
 void Floor::saveLoad(ResourceSerializer *serializer) {
@@ -187,6 +302,158 @@ void Floor::buildEdgeList() {
 		_edges[i].buildNeighbours(this);
 		_edges[i].computeMiddle(this);
 	}
+
+	// Store the neighbours and their costs contiguously for path finding
+	_edgeNeighbours.clear();
+	_edgeNeighboursStart.clear();
+	for (uint i = 0; i < _edges.size(); i++) {
+		_edgeNeighboursStart.push_back(_edgeNeighbours.size());
+
+		const Common::Array<FloorEdge *> &neighbours = _edges[i].getNeighbours();
+		for (uint j = 0; j < neighbours.size(); j++) {
+			FloorEdgeNeighbour neighbour;
+			neighbour.edgeIndex = neighbours[j]->getIndex();
+			neighbour.cost = _edges[i].costTo(neighbours[j]);
+			_edgeNeighbours.push_back(neighbour);
+		}
+	}
+	_edgeNeighboursStart.push_back(_edgeNeighbours.size());
+}
+
+void Floor::buildFaceTree() {
+	_faceTreeNodes.clear();
+	_faceTreeFaces.clear();
+
+	// Faces without vertices are never hit by the queries
+	for (uint i = 0; i < _faces.size(); i++) {
+		if (_faces[i]->hasVertices()) {
+			_faceTreeFaces.push_back(i);
+		}
+	}
+
+	if (!_faceTreeFaces.empty()) {
+		buildFaceTreeNode(0, _faceTreeFaces.size(), 1);
+	}
+}
+
+uint32 Floor::buildFaceTreeNode(uint32 firstFace, uint32 faceCount, uint32 depth) {
+	uint32 nodeIndex = _faceTreeNodes.size();
+
+	FaceTreeNode node;
+	node.minFaceIndex = _faceTreeFaces[firstFace];
+	node.children[0] = -1;
+	node.children[1] = -1;
+	node.firstFace = firstFace;
+	node.faceCount = faceCount;
+
+	Math::Vector3d centerMin, centerMax;
+	for (uint32 i = firstFace; i < firstFace + faceCount; i++) {
+		const FloorFace *face = _faces[_faceTreeFaces[i]];
+		Math::Vector3d center = face->getCenter();
+
+		for (uint j = 0; j < 3; j++) {
+			Math::Vector3d vertex = getVertex(face->getVertexIndex(j));
+			for (uint k = 0; k < 3; k++) {
+				if (i == firstFace && j == 0) {
+					node.min.setValue(k, vertex.getValue(k));
+					node.max.setValue(k, vertex.getValue(k));
+				} else {
+					node.min.setValue(k, MIN(node.min.getValue(k), vertex.getValue(k)));
+					node.max.setValue(k, MAX(node.max.getValue(k), vertex.getValue(k)));
+				}
+			}
+		}
+
+		for (uint k = 0; k < 3; k++) {
+			if (i == firstFace) {
+				centerMin.setValue(k, center.getValue(k));
+				centerMax.setValue(k, center.getValue(k));
+			} else {
+				centerMin.setValue(k, MIN(centerMin.getValue(k), center.getValue(k)));
+				centerMax.setValue(k, MAX(centerMax.getValue(k), center.getValue(k)));
+			}
+		}
+
+		node.minFaceIndex = MIN<uint32>(node.minFaceIndex, _faceTreeFaces[i]);
+	}
+
+	// Grow the bounds so that the intersections computed on the face borders are inside
+	Math::Vector3d margin(kFaceTreeMargin, kFaceTreeMargin, kFaceTreeMargin);
+	node.min -= margin;
+	node.max += margin;
+
+	_faceTreeNodes.push_back(node);
+
+	if (faceCount <= kFaceTreeLeafSize || depth >= kFaceTreeMaxDepth - 1) {
+		return nodeIndex;
+	}
+
+	// Split the faces in two halves along the axis where their centers are the most spread
+	uint32 axis = 0;
+	Math::Vector3d centerExtent = centerMax - centerMin;
+	for (uint k = 1; k < 3; k++) {
+		if (centerExtent.getValue(k) > centerExtent.getValue(axis)) {
+			axis = k;
+		}
+	}
+
+	FaceCenterComparator comparator(_faces, axis);
+	Common::sort(_faceTreeFaces.begin() + firstFace, _faceTreeFaces.begin() + firstFace + faceCount, comparator);
+
+	uint32 half = faceCount / 2;
+	int32 child0 = buildFaceTreeNode(firstFace, half, depth + 1);
+	int32 child1 = buildFaceTreeNode(firstFace + half, faceCount - half, depth + 1);
+
+	_faceTreeNodes[nodeIndex].children[0] = child0;
+	_faceTreeNodes[nodeIndex].children[1] = child1;
+
+	return nodeIndex;
+}
+
+void Floor::pushFaceTreeChildrenByIndex(const FaceTreeNode &node, uint32 *stack, uint32 &stackSize) const {
+	// The child containing the lowest face index is visited first
+	const FaceTreeNode &child0 = _faceTreeNodes[node.children[0]];
+	const FaceTreeNode &child1 = _faceTreeNodes[node.children[1]];
+
+	if (child0.minFaceIndex < child1.minFaceIndex) {
+		stack[stackSize++] = node.children[1];
+		stack[stackSize++] = node.children[0];
+	} else {
+		stack[stackSize++] = node.children[0];
+		stack[stackSize++] = node.children[1];
+	}
+}
+
+bool Floor::rayIntersectsBox(const Math::Ray &ray, const Math::Vector3d &min, const Math::Vector3d &max) {
+	Math::Vector3d origin = ray.getOrigin();
+	Math::Vector3d direction = ray.getDirection();
+
+	// Only the part of the ray in front of its origin is considered
+	float tMin = 0.0f;
+	float tMax = FLT_MAX;
+
+	for (uint i = 0; i < 3; i++) {
+		if (direction.getValue(i) == 0.0f) {
+			// The ray is parallel to the slab
+			if (origin.getValue(i) < min.getValue(i) || origin.getValue(i) > max.getValue(i)) {
+				return false;
+			}
+		} else {
+			float t1 = (min.getValue(i) - origin.getValue(i)) / direction.getValue(i);
+			float t2 = (max.getValue(i) - origin.getValue(i)) / direction.getValue(i);
+			if (t1 > t2) {
+				SWAP(t1, t2);
+			}
+
+			tMin = MAX(tMin, t1);
+			tMax = MIN(tMax, t2);
+			if (tMin > tMax) {
+				return false;
+			}
+		}
+	}
+
+	return true;
 }
 
 void Floor::addFaceEdgeToList(uint32 faceIndex, uint32 index1, uint32 index2) {
@@ -203,7 +470,7 @@ void Floor::addFaceEdgeToList(uint32 faceIndex, uint32 index1, uint32 index2) {
 		}
 	}
 
-	_edges.push_back(FloorEdge(startIndex, endIndex, faceIndex));
+	_edges.push_back(FloorEdge(startIndex, endIndex, faceIndex, _edges.size()));
 }
 
 void Floor::enableFloorField(FloorField *floorfield, bool enable) {
@@ -214,6 +481,20 @@ void Floor::enableFloorField(FloorField *floorfield, bool enable) {
 	}
 }
 
+uint32 Floor::getEdgeCount() const {
+	return _edges.size();
+}
+
+const FloorEdge *Floor::getEdge(uint32 index) const {
+	return &_edges[index];
+}
+
+const FloorEdgeNeighbour *Floor::getEdgeNeighbours(uint32 edgeIndex, uint32 &count) const {
+	uint32 start = _edgeNeighboursStart[edgeIndex];
+	count = _edgeNeighboursStart[edgeIndex + 1] - start;
+	return _edgeNeighbours.begin() + start;
+}
+
 void Floor::printData() {
 	debug("face count: %d", _facesCount);
 
@@ -223,11 +504,12 @@ void Floor::printData() {
 	}
 }
 
-FloorEdge::FloorEdge(uint16 vertexIndex1, uint16 vertexIndex2, uint32 faceIndex1) :
+FloorEdge::FloorEdge(uint16 vertexIndex1, uint16 vertexIndex2, uint32 faceIndex1, uint32 index) :
         _vertexIndex1(vertexIndex1),
         _vertexIndex2(vertexIndex2),
         _faceIndex1(faceIndex1),
         _faceIndex2(-1),
+        _index(index),
         _enabled(true) {
 }
 
@@ -239,7 +521,7 @@ void FloorEdge::setOtherFace(uint32 faceIndex) {
 	_faceIndex2 = faceIndex;
 }
 
-Common::Array<FloorEdge *> FloorEdge::getNeighbours() const {
+const Common::Array<FloorEdge *> &FloorEdge::getNeighbours() const {
 	return _neighbours;
 }
 
@@ -286,6 +568,10 @@ int32 FloorEdge::getFaceIndex2() const {
 	return _faceIndex2;
 }
 
+uint32 FloorEdge::getIndex() const {
+	return _index;
+}
+
 bool FloorEdge::isFloorBorder() const {
 	return _faceIndex2 == -1;
 }
@@ -44,6 +44,14 @@ class Floor;
 class FloorFace;
 class FloorField;
 
+/**
+ * A neighbour of a floor edge in the path finding graph
+ */
+struct FloorEdgeNeighbour {
+	uint32 edgeIndex;
+	float cost; // See FloorEdge::costTo
+};
+
 /**
  * A floor face (triangle) edge
  *
@@ -51,7 +59,7 @@ class FloorField;
  */
 class FloorEdge {
 public:
-	FloorEdge(uint16 vertexIndex1, uint16 vertexIndex2, uint32 faceIndex1);
+	FloorEdge(uint16 vertexIndex1, uint16 vertexIndex2, uint32 faceIndex1, uint32 index);
 
 	/** Build a list of neighbour edges in the graph */
 	void buildNeighbours(const Floor *floor);
@@ -66,7 +74,7 @@ public:
 	bool hasVertices(uint16 vertexIndex1, uint16 vertexIndex2) const;
 
 	/** List the edge neighbour edges in the floor */
-	Common::Array<FloorEdge *> getNeighbours() const;
+	const Common::Array<FloorEdge *> &getNeighbours() const;
 
 	/**
 	 * Computes the cost for going to a neighbour edge
@@ -92,6 +100,9 @@ public:
 	int32 getFaceIndex1() const;
 	int32 getFaceIndex2() const;
 
+	/** Get the index of the edge in the floor's edge list */
+	uint32 getIndex() const;
+
 	/** Allow or disallow characters to path using this edge */
 	void enable(bool enable);
 
@@ -110,6 +121,7 @@ private:
 	Math::Vector3d _middle;
 	int32 _faceIndex1;
 	int32 _faceIndex2;
+	uint32 _index;
 
 	bool _enabled;
 
@@ -181,6 +193,21 @@ public:
 	/** Allow or disallow characters to walk on some faces of the floor */
 	void enableFloorField(FloorField *floorfield, bool enable);
 
+	/** Get the number of edges in the path finding graph */
+	uint32 getEdgeCount() const;
+
+	/** Get a floor edge by its index */
+	const FloorEdge *getEdge(uint32 index) const;
+
+	/**
+	 * List the neighbours of an edge in the path finding graph
+	 *
+	 * @param edgeIndex The index of the edge
+	 * @param count Set to the number of neighbours
+	 * @return The first neighbour
+	 */
+	const FloorEdgeNeighbour *getEdgeNeighbours(uint32 edgeIndex, uint32 &count) const;
+
 protected:
 	void readData(Formats::XRCReadStream *stream) override;
 	void printData() override;
@@ -188,10 +215,41 @@ protected:
 	void buildEdgeList();
 	void addFaceEdgeToList(uint32 faceIndex, uint32 index1, uint32 index2);
 
+	struct FaceTreeNode;
+
+	void buildFaceTree();
+	uint32 buildFaceTreeNode(uint32 firstFace, uint32 faceCount, uint32 depth);
+	void pushFaceTreeChildrenByIndex(const FaceTreeNode &node, uint32 *stack, uint32 &stackSize) const;
+	static bool rayIntersectsBox(const Math::Ray &ray, const Math::Vector3d &min, const Math::Vector3d &max);
+
 	uint32 _facesCount;
 	Common::Array<Math::Vector3d> _vertices;
 	Common::Array<FloorFace *> _faces;
 	Common::Array<FloorEdge> _edges;
+
+	/**
+	 * A node of the bounding volume hierarchy over the floor faces
+	 *
+	 * The queries look for the face with the lowest index matching a condition,
+	 * as the original did when looping over the faces. The nodes store the lowest
+	 * face index of their subtree so that the search can stop early.
+	 */
+	struct FaceTreeNode {
+		Math::Vector3d min;
+		Math::Vector3d max;
+		uint32 minFaceIndex;
+		int32 children[2]; // -1 for leaf nodes
+		uint32 firstFace;  // For leaf nodes, position of the faces in _faceTreeFaces
+		uint32 faceCount;
+	};
+
+	// Bounding volume hierarchy over the faces with vertices, the root node is the first one
+	Common::Array<FaceTreeNode> _faceTreeNodes;
+	Common::Array<uint32> _faceTreeFaces;
+
+	// The neighbours of all the edges, stored contiguously
+	Common::Array<FloorEdgeNeighbour> _edgeNeighbours;
+	Common::Array<uint32> _edgeNeighboursStart; // Index of the first neighbour of each edge, plus the neighbour count
 };
 
 } // End of namespace Resources
@@ -212,21 +212,19 @@ void ImageStill::initVisual() {
 		return; // No file to load
 	}
 
-	Common::ReadStream *xmgStream = StarkArchiveLoader->getFile(_filename, _archiveName);
-
 	VisualImageXMG *visual = new VisualImageXMG(StarkGfx);
 
 	if (StarkSettings->isAssetsModEnabled() && loadPNGOverride(visual)) {
+		Common::ReadStream *xmgStream = StarkArchiveLoader->getFile(_filename, _archiveName);
 		visual->readOriginalSize(xmgStream);
+		delete xmgStream;
 	} else {
-		visual->load(xmgStream);
+		visual->load(StarkArchiveLoader->decodeImage(_filename, _archiveName));
 	}
 
 	visual->setHotSpot(_hotspot);
 
 	_visual = visual;
-
-	delete xmgStream;
 }
 
 bool ImageStill::loadPNGOverride(VisualImageXMG *visual) const {
@@ -101,10 +101,13 @@ Object::Object(Object *parent, byte subType, uint16 index, const Common::String
 		_type(Type::kInvalid),
 		_subType(subType),
 		_index(index),
-		_name(name) {
+		_name(name),
+		_childIndex(nullptr) {
 }
 
 Object::~Object() {
+	delete _childIndex;
+
 	// Delete the children resources
 	Common::Array<Object *>::iterator i = _children.begin();
 	while (i != _children.end()) {
@@ -207,7 +210,38 @@ void Object::printWithDepth(uint depth, const Common::String &string) const {
 	debug("%s %s", prefix.c_str(), string.c_str());
 }
 
+uint32 Object::childIndexKey(Type type, uint16 index) {
+	return (uint32)type.get() << 16 | index;
+}
+
+void Object::buildChildIndex() const {
+	_childIndex = new ChildIndexMap();
+
+	for (uint i = 0; i < _children.size(); i++) {
+		uint32 key = childIndexKey(_children[i]->getType(), _children[i]->getIndex());
+		if (!_childIndex->contains(key)) {
+			_childIndex->setVal(key, _children[i]);
+		}
+	}
+}
+
 Object *Object::findChildWithIndex(Type type, uint16 index, int subType) const {
+	// Resources with only a few children are searched linearly
+	static const uint minChildrenForIndex = 8;
+
+	if (_children.size() >= minChildrenForIndex) {
+		if (!_childIndex) {
+			buildChildIndex();
+		}
+
+		Object *child = _childIndex->getVal(childIndexKey(type, index), nullptr);
+		if (!child || subType == -1 || child->getSubType() == subType) {
+			return child;
+		}
+
+		// The first child with this type and index has another subtype, search the others
+	}
+
 	for (uint i = 0; i < _children.size(); i++) {
 		if (_children[i]->getType() == type
 				&& (_children[i]->getSubType() == subType || subType == -1)
@@ -275,6 +309,9 @@ Object *Object::findParent() {
 
 void Object::addChild(Object *child) {
 	_children.push_back(child);
+
+	delete _childIndex;
+	_childIndex = nullptr;
 }
 
 UnimplementedResource::UnimplementedResource(Object *parent, Type type, byte subType, uint16 index, const Common::String &name) :
@@ -24,6 +24,7 @@
 #define STARK_RESOURCES_RESOURCE_H
 
 #include "common/array.h"
+#include "common/hashmap.h"
 #include "common/str.h"
 
 namespace Stark {
@@ -283,6 +284,15 @@ protected:
 
 	Object *_parent;
 	Common::Array<Object *> _children;
+
+private:
+	/** First child for each type and index pair, built lazily for resources with many children */
+	typedef Common::HashMap<uint32, Object *> ChildIndexMap;
+
+	static uint32 childIndexKey(Type type, uint16 index);
+	void buildChildIndex() const;
+
+	mutable ChildIndexMap *_childIndex;
 };
 
 /**
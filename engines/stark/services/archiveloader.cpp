@@ -22,9 +22,13 @@
 
 #include "engines/stark/services/archiveloader.h"
 
+#include "engines/stark/formats/xmg.h"
 #include "engines/stark/formats/xrc.h"
+#include "engines/stark/resourcereference.h"
 #include "engines/stark/resources/level.h"
 #include "engines/stark/resources/location.h"
+#include "engines/stark/services/services.h"
+#include "engines/stark/services/settings.h"
 
 namespace Stark {
 
@@ -49,10 +53,18 @@ void ArchiveLoader::LoadedArchive::importResources() {
 	_root = Formats::XRCReader::importTree(&_xarc);
 }
 
+ArchiveLoader::ArchiveLoader() :
+		_imageCacheSize(0) {
+}
+
 ArchiveLoader::~ArchiveLoader() {
 	for (LoadedArchiveList::iterator it = _archives.begin(); it != _archives.end(); it++) {
 		delete *it;
 	}
+
+	discardPreloaded();
+
+	clearImageCache();
 }
 
 bool ArchiveLoader::load(const Common::String &archiveName) {
@@ -61,20 +73,72 @@ bool ArchiveLoader::load(const Common::String &archiveName) {
 		return false;
 	}
 
+	for (LoadedArchiveList::iterator it = _preloadedArchives.begin(); it != _preloadedArchives.end(); it++) {
+		if ((*it)->getFilename() == archiveName) {
+			// The resource tree was built ahead of time, it just needs to be made available
+			_archives.push_back(*it);
+			_preloadedArchives.erase(it);
+
+			ResourceReference::invalidateResolvedResources();
+
+			return true;
+		}
+	}
+
 	LoadedArchive *archive = new LoadedArchive(archiveName);
 	_archives.push_back(archive);
 
 	archive->importResources();
 
+	ResourceReference::invalidateResolvedResources();
+
 	return true;
 }
 
+void ArchiveLoader::preload(const Common::String &archiveName) {
+	if (isLoadedOrPreloaded(archiveName)) {
+		return;
+	}
+
+	// The archive needs to be in a list before importing the resources,
+	// so that the resources can read their data from it
+	LoadedArchive *archive = new LoadedArchive(archiveName);
+	_preloadedArchives.push_back(archive);
+
+	archive->importResources();
+}
+
+bool ArchiveLoader::isLoadedOrPreloaded(const Common::String &archiveName) const {
+	if (hasArchive(archiveName)) {
+		return true;
+	}
+
+	for (LoadedArchiveList::const_iterator it = _preloadedArchives.begin(); it != _preloadedArchives.end(); it++) {
+		if ((*it)->getFilename() == archiveName) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ArchiveLoader::discardPreloaded() {
+	for (LoadedArchiveList::iterator it = _preloadedArchives.begin(); it != _preloadedArchives.end(); it++) {
+		delete *it;
+	}
+
+	_preloadedArchives.clear();
+}
+
 void ArchiveLoader::unloadUnused() {
 	for (LoadedArchiveList::iterator it = _archives.begin(); it != _archives.end(); it++) {
 		if (!(*it)->isInUse()) {
 			delete *it;
 			it = _archives.erase(it);
 			it--;
+
+			// References may point to resources in the unloaded archive
+			ResourceReference::invalidateResolvedResources();
 		}
 	}
 }
@@ -91,6 +155,69 @@ ArchiveReadStream *ArchiveLoader::getFile(const Common::String &fileName, const
 	return new ArchiveReadStream(stream);
 }
 
+Graphics::Surface *ArchiveLoader::decodeImage(const Common::String &fileName, const Common::String &archiveName) {
+	for (CachedImageList::iterator it = _imageCache.begin(); it != _imageCache.end(); it++) {
+		if (it->fileName == fileName && it->archiveName == archiveName) {
+			// Move the image to the front of the cache
+			CachedImage image = *it;
+			_imageCache.erase(it);
+			_imageCache.push_front(image);
+
+			Graphics::Surface *surface = new Graphics::Surface();
+			surface->copyFrom(*image.surface);
+			return surface;
+		}
+	}
+
+	ArchiveReadStream *stream = getFile(fileName, archiveName);
+	if (!stream) {
+		return nullptr;
+	}
+
+	Graphics::Surface *surface = Formats::XMGDecoder::decode(stream);
+	delete stream;
+
+	addImageToCache(fileName, archiveName, surface);
+
+	return surface;
+}
+
+void ArchiveLoader::addImageToCache(const Common::String &fileName, const Common::String &archiveName, const Graphics::Surface *surface) {
+	uint32 maxSize = StarkSettings->getImageCacheSize();
+	uint32 imageSize = surface->pitch * surface->h;
+	if (imageSize > maxSize) {
+		return; // The cache is disabled or the image is too large
+	}
+
+	// Evict the least recently used images
+	while (!_imageCache.empty() && _imageCacheSize + imageSize > maxSize) {
+		CachedImage &image = _imageCache.back();
+		_imageCacheSize -= image.surface->pitch * image.surface->h;
+		image.surface->free();
+		delete image.surface;
+		_imageCache.pop_back();
+	}
+
+	CachedImage image;
+	image.archiveName = archiveName;
+	image.fileName = fileName;
+	image.surface = new Graphics::Surface();
+	image.surface->copyFrom(*surface);
+
+	_imageCache.push_front(image);
+	_imageCacheSize += imageSize;
+}
+
+void ArchiveLoader::clearImageCache() {
+	for (CachedImageList::iterator it = _imageCache.begin(); it != _imageCache.end(); it++) {
+		it->surface->free();
+		delete it->surface;
+	}
+
+	_imageCache.clear();
+	_imageCacheSize = 0;
+}
+
 bool ArchiveLoader::returnRoot(const Common::String &archiveName) {
 	LoadedArchive *archive = findArchive(archiveName);
 	archive->decUsage();
@@ -115,6 +242,12 @@ ArchiveLoader::LoadedArchive *ArchiveLoader::findArchive(const Common::String &a
 		}
 	}
 
+	for (LoadedArchiveList::const_iterator it = _preloadedArchives.begin(); it != _preloadedArchives.end(); it++) {
+		if ((*it)->getFilename() == archiveName) {
+			return *it;
+		}
+	}
+
 	error("The archive with name '%s' is not loaded.", archiveName.c_str());
 }
 
@@ -28,6 +28,8 @@
 #include "common/substream.h"
 #include "common/util.h"
 
+#include "graphics/surface.h"
+
 #include "math/quat.h"
 #include "math/vector3d.h"
 
@@ -65,11 +67,26 @@ public:
 class ArchiveLoader {
 
 public:
+	ArchiveLoader();
 	~ArchiveLoader();
 
 	/** Load a Xarc archive, and add it to the managed archives list */
 	bool load(const Common::String &archiveName);
 
+	/**
+	 * Load a Xarc archive ahead of time, without adding it to the managed archives list
+	 *
+	 * The next call to load for this archive uses the preloaded resource tree
+	 * instead of reading it again.
+	 */
+	void preload(const Common::String &archiveName);
+
+	/** Is an archive either loaded or preloaded? */
+	bool isLoadedOrPreloaded(const Common::String &archiveName) const;
+
+	/** Free the preloaded archives that have not been loaded */
+	void discardPreloaded();
+
 	/** Unload all the unused Xarc archives */
 	void unloadUnused();
 
@@ -80,6 +97,21 @@ public:
 	template <class T>
 	T *useRoot(const Common::String &archiveName);
 
+	/**
+	 * Decode a XMG image from a specified archive
+	 *
+	 * The decoded images are kept in a cache so that re-entering a location
+	 * does not need decoding them again. The returned surface is owned by the caller.
+	 */
+	Graphics::Surface *decodeImage(const Common::String &fileName, const Common::String &archiveName);
+
+	/** Free all the images kept in the decoded images cache */
+	void clearImageCache();
+
+	/** Get the resource tree root for a loaded or preloaded archive, without changing its use count */
+	template <class T>
+	T *peekRoot(const Common::String &archiveName) const;
+
 	/** Decrement the root's archive use count */
 	bool returnRoot(const Common::String &archiveName);
 
@@ -118,7 +150,21 @@ private:
 	bool hasArchive(const Common::String &archiveName) const;
 	LoadedArchive *findArchive(const Common::String &archiveName) const;
 
+	struct CachedImage {
+		Common::String archiveName;
+		Common::String fileName;
+		Graphics::Surface *surface;
+	};
+
+	typedef Common::List<CachedImage> CachedImageList;
+
+	void addImageToCache(const Common::String &fileName, const Common::String &archiveName, const Graphics::Surface *surface);
+
 	LoadedArchiveList _archives;
+	LoadedArchiveList _preloadedArchives;
+
+	CachedImageList _imageCache; // Most recently used images first
+	uint32 _imageCacheSize;
 };
 
 template <class T>
@@ -128,6 +174,12 @@ T *ArchiveLoader::useRoot(const Common::String &archiveName) {
 	return Resources::Object::cast<T>(archive->getRoot());
 }
 
+template <class T>
+T *ArchiveLoader::peekRoot(const Common::String &archiveName) const {
+	LoadedArchive *archive = findArchive(archiveName);
+	return Resources::Object::cast<T>(archive->getRoot());
+}
+
 } // End of namespace Stark
 
 #endif // STARK_SERVICES_ARCHIVE_LOADER_H
@@ -48,6 +48,9 @@ ResourceProvider::ResourceProvider(ArchiveLoader *archiveLoader, StateProvider *
 		_global(global),
 		_locationChangeRequest(false),
 		_restoreCurrentState(false),
+		_locationPreloadRequest(false),
+		_preloadLevel(0),
+		_preloadLocation(0),
 		_nextDirection(0) {
 }
 
@@ -199,9 +202,53 @@ void ResourceProvider::requestLocationChange(uint16 level, uint16 location) {
 		_stateProvider->restoreLocationState(currentLocation->getLevel(), currentLocation->getLocation());
 	}
 
+	// Any remaining preloaded resources were for another location
+	_archiveLoader->discardPreloaded();
+	_locationPreloadRequest = false;
+
 	_locationChangeRequest = true;
 }
 
+void ResourceProvider::requestLocationPreload(uint16 level, uint16 location) {
+	_locationPreloadRequest = true;
+	_preloadLevel = level;
+	_preloadLocation = location;
+}
+
+void ResourceProvider::continuePreloading() {
+	if (!_locationPreloadRequest) {
+		return;
+	}
+
+	Resources::Root *root = _global->getRoot();
+	Resources::Level *rootLevelResource = root->findChildWithIndex<Resources::Level>(_preloadLevel);
+	if (!rootLevelResource) {
+		warning("Unable to preload unknown level %x", _preloadLevel);
+		_locationPreloadRequest = false;
+		return;
+	}
+
+	// Only preload one archive per call to limit the duration of a frame
+	Common::String levelArchive = _archiveLoader->buildArchiveName(rootLevelResource);
+	if (!_archiveLoader->isLoadedOrPreloaded(levelArchive)) {
+		_archiveLoader->preload(levelArchive);
+		return;
+	}
+
+	Resources::Level *levelResource = _archiveLoader->peekRoot<Resources::Level>(levelArchive);
+	Resources::Location *levelLocationResource = levelResource->findChildWithIndex<Resources::Location>(_preloadLocation);
+	if (!levelLocationResource) {
+		warning("Unable to preload unknown location %x in level %x", _preloadLocation, _preloadLevel);
+		_locationPreloadRequest = false;
+		return;
+	}
+
+	Common::String locationArchive = _archiveLoader->buildArchiveName(levelResource, levelLocationResource);
+	_archiveLoader->preload(locationArchive);
+
+	_locationPreloadRequest = false;
+}
+
 void ResourceProvider::performLocationChange() {
 	Current *current = _locations.back();
 	Current *previous = _global->getCurrent();
@@ -226,6 +273,7 @@ void ResourceProvider::performLocationChange() {
 
 	// Set the new current location
 	_global->setCurrent(current);
+	ResourceReference::invalidateResolvedResources();
 
 	// Resources lifecycle update
 	_global->getLevel()->onEnterLocation();
@@ -331,6 +379,9 @@ void ResourceProvider::purgeOldLocations() {
 	}
 
 	_archiveLoader->unloadUnused();
+
+	// The purged locations can no longer be resolved
+	ResourceReference::invalidateResolvedResources();
 }
 
 void ResourceProvider::commitActiveLocationsState() {
@@ -381,7 +432,11 @@ void ResourceProvider::shutdown() {
 	_global->setInventory(nullptr);
 	_global->setApril(nullptr);
 
+	_locationPreloadRequest = false;
+	_archiveLoader->discardPreloaded();
 	_archiveLoader->unloadUnused();
+
+	ResourceReference::invalidateResolvedResources();
 }
 
 Resources::Level *ResourceProvider::getLevelFromLocation(Resources::Location *location) const {
@@ -56,6 +56,17 @@ public:
 	/** Load the resources for the specified location */
 	void requestLocationChange(uint16 level, uint16 location);
 
+	/**
+	 * Start loading the resources of a location the game is likely to change to
+	 *
+	 * The archives are loaded one per game loop by continuePreloading, so that
+	 * the loading is spread over the frames preceding the location change.
+	 */
+	void requestLocationPreload(uint16 level, uint16 location);
+
+	/** Load the next archive needed by the pending location preload request, if any */
+	void continuePreloading();
+
 	/** Is a location change pending? */
 	bool hasLocationChangeRequest() const { return _locationChangeRequest; }
 
@@ -124,6 +135,10 @@ private:
 	bool _locationChangeRequest;
 	bool _restoreCurrentState;
 
+	bool _locationPreloadRequest;
+	uint16 _preloadLevel;
+	uint16 _preloadLocation;
+
 	CurrentList _locations;
 
 	ResourceReference _nextPositionBookmarkReference;
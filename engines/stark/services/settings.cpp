@@ -59,6 +59,7 @@ Settings::Settings(Audio::Mixer *mixer, const ADGameDescription *gd) :
 	ConfMan.registerDefault(_intKey[kSaveLoadPage], 0);
 	ConfMan.registerDefault("replacement_png_premultiply_alpha", false);
 	ConfMan.registerDefault("ignore_font_settings", true);
+	ConfMan.registerDefault("image_cache_size", 32);
 
 	// Use the FunCom logo video to check low-resolution fmv
 	Common::SeekableReadStream *lowResFMV = StarkArchiveLoader->getExternalFile("1402_lo_res.bbb", "Global/");
@@ -95,6 +96,12 @@ bool Settings::shouldPreMultiplyReplacementPNGs() const {
 	return ConfMan.getBool("replacement_png_premultiply_alpha");
 }
 
+uint32 Settings::getImageCacheSize() const {
+	// The setting is in megabytes
+	int size = ConfMan.getInt("image_cache_size");
+	return CLIP(size, 0, 1024) * 1024 * 1024;
+}
+
 Gfx::Texture::SamplingFilter Settings::getImageSamplingFilter() const {
 	return ConfMan.getBool("use_linear_filtering") ? Gfx::Texture::kLinear : Gfx::Texture::kNearest;
 }
@@ -111,6 +111,14 @@ public:
 	 */
 	bool shouldPreMultiplyReplacementPNGs() const;
 
+	/**
+	 * The maximum size in bytes of the decoded images kept in memory
+	 *
+	 * Keeping the decoded background images avoids decoding them again when
+	 * re-entering a location. The cache is disabled when the size is zero.
+	 */
+	uint32 getImageCacheSize() const;
+
 	/** Should linear filtering be used when sampling the background image textures? */
 	Gfx::Texture::SamplingFilter getImageSamplingFilter() const;
 
@@ -22,6 +22,7 @@
 
 #include "engines/stark/services/staticprovider.h"
 
+#include "engines/stark/resourcereference.h"
 #include "engines/stark/resources/anim.h"
 #include "engines/stark/resources/animscript.h"
 #include "engines/stark/resources/container.h"
@@ -129,6 +130,9 @@ Resources::Location *StaticProvider::loadLocation(const char *locationName) {
 	_archiveLoader->load(archiveName);
 	_location = _archiveLoader->useRoot<Resources::Location>(archiveName);
 
+	// Resource references resolve differently while a static location is active
+	ResourceReference::invalidateResolvedResources();
+
 	_location->onAllLoaded();
 	_location->onEnterLocation();
 
@@ -151,6 +155,7 @@ void StaticProvider::unloadLocation(Resources::Location *location) {
 	_archiveLoader->unloadUnused();
 
 	_location = nullptr;
+	ResourceReference::invalidateResolvedResources();
 }
 
 bool StaticProvider::isStaticLocation() const {
@@ -82,7 +82,6 @@ StarkEngine::~StarkEngine() {
 	delete StarkServices::instance().dialogPlayer;
 	delete StarkServices::instance().randomSource;
 	delete StarkServices::instance().scene;
-	delete StarkServices::instance().gfx;
 	delete StarkServices::instance().staticProvider;
 	delete StarkServices::instance().resourceProvider;
 	delete StarkServices::instance().global;
@@ -94,6 +93,9 @@ StarkEngine::~StarkEngine() {
 	delete StarkServices::instance().gameChapter;
 	delete StarkServices::instance().gameMessage;
 
+	// The renderer is deleted last, all the textures need to be freed beforehand
+	delete StarkServices::instance().gfx;
+
 	StarkServices::destroy();
 
 	delete _console;
@@ -180,10 +182,14 @@ void StarkEngine::mainLoop() {
 		StarkUserInterface->doQueuedScreenChange();
 
 		updateDisplayScene();
+		ResourceReference::countResolveStatsFrame();
 
 		// Swap buffers
 		_frameLimiter->delayBeforeSwap();
 		StarkGfx->flipBuffer();
+
+		// Load the resources for the next location while the current one fades out
+		StarkResourceProvider->continuePreloading();
 	}
 }
 
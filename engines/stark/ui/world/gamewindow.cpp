@@ -76,6 +76,7 @@ void GameWindow::onRender() {
 	// List the items to render
 	Resources::Location *location = StarkGlobal->getCurrent()->getLocation();
 	_renderEntries = location->listRenderEntries();
+	_pickingGrid.build(_renderEntries);
 	Gfx::LightEntryArray lightEntries = location->listLightEntries();
 
 	// Render all the scene items
@@ -116,7 +117,12 @@ void GameWindow::onRender() {
 }
 
 void GameWindow::onMouseMove(const Common::Point &pos) {
-	_renderEntries = StarkGlobal->getCurrent()->getLocation()->listRenderEntries();
+	if (_renderEntries.empty()) {
+		// Nothing was rendered yet for the current location
+		_renderEntries = StarkGlobal->getCurrent()->getLocation()->listRenderEntries();
+		_pickingGrid.build(_renderEntries);
+	}
+
 	_cursor->setFading(false);
 
 	if (!StarkUserInterface->isInteractive()) {
@@ -235,12 +241,13 @@ void GameWindow::checkObjectAtPos(const Common::Point &pos, int16 selectedInvent
 		cursorRect.translate(pos.x, pos.y);
 	}
 
-	// Render entries are sorted from the farthest to the camera to the nearest
-	// Loop in reverse order
-	for (int i = _renderEntries.size() - 1; i >= 0; i--) {
-		if (_renderEntries[i]->containsPoint(pos, _objectRelativePosition, cursorRect)
-		    || _renderEntries[i]->intersectRay(ray)) {
-			_objectUnderCursor = _renderEntries[i]->getOwner();
+	// Only test the entries that may be under the cursor, from the nearest to the camera to the farthest
+	_pickingGrid.listCandidates(pos, cursorRect, _pickingCandidates);
+	for (uint i = 0; i < _pickingCandidates.size(); i++) {
+		Gfx::RenderEntry *entry = _renderEntries[_pickingCandidates[i]];
+		if (entry->containsPoint(pos, _objectRelativePosition, cursorRect)
+		    || entry->intersectRay(ray)) {
+			_objectUnderCursor = entry->getOwner();
 			break;
 		}
 	}
@@ -274,6 +281,7 @@ void GameWindow::checkObjectAtPos(const Common::Point &pos, int16 selectedInvent
 
 void GameWindow::reset() {
 	_renderEntries.clear();
+	_pickingGrid.clear();
 	_objectUnderCursor = nullptr;
 	_objectRelativePosition.x = 0;
 	_objectRelativePosition.y = 0;
@@ -24,6 +24,7 @@
 #define STARK_UI_GAME_WINDOW_H
 
 #include "engines/stark/gfx/faderenderer.h"
+#include "engines/stark/gfx/pickinggrid.h"
 #include "engines/stark/gfx/renderentry.h"
 
 #include "engines/stark/ui/window.h"
@@ -64,6 +65,8 @@ protected:
 	InventoryWindow *_inventory;
 
 	Gfx::RenderEntryArray _renderEntries;
+	Gfx::PickingGrid _pickingGrid;
+	Common::Array<uint> _pickingCandidates;
 	Resources::ItemVisual *_objectUnderCursor;
 	Common::Point _objectRelativePosition;
 
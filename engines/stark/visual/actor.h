@@ -28,6 +28,7 @@
 #include "common/array.h"
 #include "common/rect.h"
 
+#include "math/matrix3.h"
 #include "math/matrix4.h"
 #include "math/ray.h"
 #include "math/vector3d.h"
@@ -82,6 +83,21 @@ protected:
 
 	Math::Matrix4 getModelMatrix(const Math::Vector3d &position, float direction) const;
 	const Gfx::Texture *resolveTexture(const Material *material) const;
+
+	/**
+	 * Compute the direction of the actor's shadow in model space
+	 *
+	 * The direction is the weighted sum of the directions of the lights
+	 * shining on the actor, with a clipped horizontal length.
+	 */
+	Math::Vector3d computeShadowDirection(const Common::Array<Gfx::LightEntry *> &lights,
+			const Math::Vector3d &actorPosition, Math::Matrix3 worldToModelRot) const;
+
+private:
+	static bool getPointLightContribution(Gfx::LightEntry *light, const Math::Vector3d &actorPosition,
+			Math::Vector3d &direction, float weight = 1.0f);
+	static bool getDirectionalLightContribution(Gfx::LightEntry *light, Math::Vector3d &direction);
+	static bool getSpotLightContribution(Gfx::LightEntry *light, const Math::Vector3d &actorPosition, Math::Vector3d &direction);
 };
 
 } // End of namespace Stark
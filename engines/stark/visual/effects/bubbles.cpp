@@ -62,16 +62,16 @@ void VisualEffectBubbles::render(const Common::Point &position) {
 	if (_timeRemainingUntilNextUpdate <= 0) {
 		update();
 		_timeRemainingUntilNextUpdate = _timeBetweenTwoUpdates;
-	}
 
-	// Fill with transparent color
-	_surface->fillRect(Common::Rect(_surface->w, _surface->h), 0);
+		eraseParticles();
 
-	for (uint i = 0; i < _bubbles.size(); i++) {
-		drawBubble(_bubbles[i]);
+		for (uint i = 0; i < _bubbles.size(); i++) {
+			drawBubble(_bubbles[i]);
+		}
+
+		uploadParticles();
 	}
 
-	_texture->update(_surface);
 	_surfaceRenderer->render(_texture, position);
 }
 
@@ -169,7 +169,7 @@ void VisualEffectBubbles::update() {
 	}
 }
 
-void VisualEffectBubbles::drawBubble(const Bubble &bubble) const {
+void VisualEffectBubbles::drawBubble(const Bubble &bubble) {
 	if (bubble.position.x == -1 && bubble.position.y == -1) {
 		return;
 	}
@@ -181,7 +181,7 @@ void VisualEffectBubbles::drawBubble(const Bubble &bubble) const {
 	}
 }
 
-void VisualEffectBubbles::drawSmallBubble(const Bubble &bubble) const {
+void VisualEffectBubbles::drawSmallBubble(const Bubble &bubble) {
 	if (bubble.position.x < 0 || bubble.position.x >= _surface->w
 	    || bubble.position.y < 0 || bubble.position.y >= _surface->h) {
 			return;
@@ -189,9 +189,11 @@ void VisualEffectBubbles::drawSmallBubble(const Bubble &bubble) const {
 
 	uint32 *pixel = static_cast<uint32 *>(_surface->getBasePtr(bubble.position.x, bubble.position.y));
 	*pixel = _mainColor;
+
+	markParticleDrawn(Common::Rect(bubble.position.x, bubble.position.y, bubble.position.x + 1, bubble.position.y + 1));
 }
 
-void VisualEffectBubbles::drawLargeBubble(const Bubble &bubble) const {
+void VisualEffectBubbles::drawLargeBubble(const Bubble &bubble) {
 	if (bubble.position.x < 1 || bubble.position.x >= _surface->w - 1
 	    || bubble.position.y < 1 || bubble.position.y >= _surface->h - 1) {
 		return;
@@ -207,6 +209,8 @@ void VisualEffectBubbles::drawLargeBubble(const Bubble &bubble) const {
 
 	pixel = static_cast<uint32 *>(_surface->getBasePtr(bubble.position.x, bubble.position.y + 1));
 	*pixel = _darkColor;
+
+	markParticleDrawn(Common::Rect(bubble.position.x - 1, bubble.position.y - 1, bubble.position.x + 2, bubble.position.y + 2));
 }
 
 } // End of namespace Stark
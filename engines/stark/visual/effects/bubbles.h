@@ -82,9 +82,9 @@ private:
 	Common::Array<Bubble> _bubbles;
 
 	void update();
-	void drawBubble(const Bubble &bubble) const;
-	void drawSmallBubble(const Bubble &bubble) const;
-	void drawLargeBubble(const Bubble &bubble) const;
+	void drawBubble(const Bubble &bubble);
+	void drawSmallBubble(const Bubble &bubble);
+	void drawLargeBubble(const Bubble &bubble);
 };
 
 } // End of namespace Stark
@@ -56,4 +56,36 @@ VisualEffect::~VisualEffect() {
 	delete _surfaceRenderer;
 }
 
+void VisualEffect::extendArea(Common::Rect &area, const Common::Rect &other) {
+	if (area.isEmpty()) {
+		area = other;
+	} else if (!other.isEmpty()) {
+		area.extend(other);
+	}
+}
+
+void VisualEffect::eraseParticles() {
+	for (uint i = 0; i < _drawnAreas.size(); i++) {
+		_surface->fillRect(_drawnAreas[i], 0);
+		extendArea(_dirtyArea, _drawnAreas[i]);
+	}
+
+	_drawnAreas.clear();
+}
+
+void VisualEffect::markParticleDrawn(const Common::Rect &area) {
+	Common::Rect clippedArea = area.findIntersectingRect(Common::Rect(_surface->w, _surface->h));
+	if (clippedArea.isEmpty()) {
+		return;
+	}
+
+	_drawnAreas.push_back(clippedArea);
+	extendArea(_dirtyArea, clippedArea);
+}
+
+void VisualEffect::uploadParticles() {
+	_texture->updateArea(_surface, _dirtyArea);
+	_dirtyArea = Common::Rect();
+}
+
 } // End of namespace Stark
@@ -25,6 +25,7 @@
 
 #include "engines/stark/visual/visual.h"
 
+#include "common/array.h"
 #include "common/rect.h"
 
 #include "graphics/pixelformat.h"
@@ -44,7 +45,9 @@ class Texture;
 /**
  * A 2D visual effect overlay
  *
- * The backing surface is alpha blended on top of the scene
+ * The backing surface is alpha blended on top of the scene.
+ * It is only redrawn when the particles move, and only the
+ * areas touched by the particles are erased and uploaded.
  */
 class VisualEffect : public Visual {
 public:
@@ -52,6 +55,15 @@ public:
 	~VisualEffect() override;
 
 protected:
+	/** Erase the particles drawn during the previous update from the backing surface */
+	void eraseParticles();
+
+	/** Record an area of the backing surface drawn to during the current update */
+	void markParticleDrawn(const Common::Rect &area);
+
+	/** Upload the areas of the backing surface changed since the previous update */
+	void uploadParticles();
+
 	Gfx::Driver *_gfx;
 	Gfx::SurfaceRenderer *_surfaceRenderer;
 	Gfx::Texture *_texture;
@@ -60,6 +72,12 @@ protected:
 	uint _timeBetweenTwoUpdates;
 	int _timeRemainingUntilNextUpdate;
 	Common::Point _size;
+
+private:
+	static void extendArea(Common::Rect &area, const Common::Rect &other);
+
+	Common::Array<Common::Rect> _drawnAreas;
+	Common::Rect _dirtyArea;
 };
 
 } // End of namespace Stark
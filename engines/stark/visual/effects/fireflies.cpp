@@ -56,16 +56,16 @@ void VisualEffectFireFlies::render(const Common::Point &position) {
 	if (_timeRemainingUntilNextUpdate <= 0) {
 		update();
 		_timeRemainingUntilNextUpdate = _timeBetweenTwoUpdates;
-	}
 
-	// Fill with transparent color
-	_surface->fillRect(Common::Rect(_surface->w, _surface->h), 0);
+		eraseParticles();
 
-	for (uint i = 0; i < _fireFlies.size(); i++) {
-		drawFireFly(_fireFlies[i]);
+		for (uint i = 0; i < _fireFlies.size(); i++) {
+			drawFireFly(_fireFlies[i]);
+		}
+
+		uploadParticles();
 	}
 
-	_texture->update(_surface);
 	_surfaceRenderer->render(_texture, position);
 }
 
@@ -177,6 +177,8 @@ void VisualEffectFireFlies::drawFireFly(const FireFly &fly) {
 
 	uint32 *pixel = static_cast<uint32 *>(_surface->getBasePtr(fly.currentPosition.x, fly.currentPosition.y));
 	*pixel = _frames[fly.currentFrame].color;
+
+	markParticleDrawn(Common::Rect(fly.currentPosition.x, fly.currentPosition.y, fly.currentPosition.x + 1, fly.currentPosition.y + 1));
 }
 
 } // End of namespace Stark
@@ -67,16 +67,16 @@ void VisualEffectFish::render(const Common::Point &position) {
 	if (_timeRemainingUntilNextUpdate <= 0) {
 		update();
 		_timeRemainingUntilNextUpdate = _timeBetweenTwoUpdates;
-	}
 
-	// Fill with transparent color
-	_surface->fillRect(Common::Rect(_surface->w, _surface->h), 0);
+		eraseParticles();
 
-	for (uint i = 0; i < _fishList.size(); i++) {
-		drawFish(_fishList[i]);
+		for (uint i = 0; i < _fishList.size(); i++) {
+			drawFish(_fishList[i]);
+		}
+
+		uploadParticles();
 	}
 
-	_texture->update(_surface);
 	_surfaceRenderer->render(_texture, position);
 }
 
@@ -246,6 +246,13 @@ void VisualEffectFish::drawFish(const Fish &fish) {
 	}
 	_surface->drawLine(fish.previousPosition.x, fish.previousPosition.y,
 	                   fish.currentPosition.x,  fish.currentPosition.y, color);
+
+	markParticleDrawn(Common::Rect(
+			MIN(fish.previousPosition.x, fish.currentPosition.x),
+			MIN(fish.previousPosition.y, fish.currentPosition.y),
+			MAX(fish.previousPosition.x, fish.currentPosition.x) + 1,
+			MAX(fish.previousPosition.y, fish.currentPosition.y) + 1
+	));
 }
 
 } // End of namespace Stark
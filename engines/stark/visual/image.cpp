@@ -39,6 +39,7 @@ VisualImageXMG::VisualImageXMG(Gfx::Driver *gfx) :
 		_gfx(gfx),
 		_texture(nullptr),
 		_surface(nullptr),
+		_solidMaskPitch(0),
 		_originalWidth(0),
 		_originalHeight(0) {
 	_surfaceRenderer = _gfx->createSurfaceRenderer();
@@ -57,16 +58,17 @@ void VisualImageXMG::setHotSpot(const Common::Point &hotspot) {
 	_hotspot = hotspot;
 }
 
-void VisualImageXMG::load(Common::ReadStream *stream) {
+void VisualImageXMG::load(Graphics::Surface *surface) {
 	assert(!_surface && !_texture);
 
-	// Decode the XMG
-	_surface = Formats::XMGDecoder::decode(stream);
+	_surface = surface;
 	_texture = _gfx->createTexture(_surface);
 	_texture->setSamplingFilter(StarkSettings->getImageSamplingFilter());
 
 	_originalWidth  = _surface->w;
 	_originalHeight = _surface->h;
+
+	buildSolidMask();
 }
 
 void VisualImageXMG::readOriginalSize(Common::ReadStream *stream) {
@@ -98,9 +100,33 @@ bool VisualImageXMG::loadPNG(Common::SeekableReadStream *stream) {
 	_texture = _gfx->createTexture(_surface);
 	_texture->setSamplingFilter(StarkSettings->getImageSamplingFilter());
 
+	buildSolidMask();
+
 	return true;
 }
 
+void VisualImageXMG::buildSolidMask() {
+	// One bit per pixel, set when the pixel is fully opaque
+	_solidMaskPitch = (_surface->w + 31) / 32;
+	_solidMask.clear();
+	_solidMask.resize(_solidMaskPitch * _surface->h);
+
+	for (uint y = 0; y < _surface->h; y++) {
+		const uint8 *src = (const uint8 *) _surface->getBasePtr(0, y);
+		uint32 *row = &_solidMask[y * _solidMaskPitch];
+
+		for (uint x = 0; x < _surface->w; x++) {
+			uint32 bits = 0;
+			if (src[3] == 0xFF) {
+				bits = 1u << (x % 32);
+			}
+
+			row[x / 32] |= bits;
+			src += 4;
+		}
+	}
+}
+
 Graphics::Surface *VisualImageXMG::multiplyColorWithAlpha(const Graphics::Surface *source) {
 	assert(source->format == Gfx::Driver::getRGBAPixelFormat());
 
@@ -164,12 +190,11 @@ bool VisualImageXMG::isPointSolid(const Common::Point &point) const {
 	Common::Point scaledPoint;
 	scaledPoint.x = point.x * _surface->w / _originalWidth;
 	scaledPoint.y = point.y * _surface->h / _originalHeight;
-	scaledPoint.x = CLIP<uint16>(scaledPoint.x, 0, _surface->w);
-	scaledPoint.y = CLIP<uint16>(scaledPoint.y, 0, _surface->h);
+	scaledPoint.x = CLIP<int16>(scaledPoint.x, 0, _surface->w - 1);
+	scaledPoint.y = CLIP<int16>(scaledPoint.y, 0, _surface->h - 1);
 
-	// Maybe implement this method in some other way to avoid having to keep the surface in memory
-	const byte *ptr = (const byte *) _surface->getBasePtr(scaledPoint.x, scaledPoint.y);
-	return *(ptr + 3) == 0xFF;
+	uint32 bits = _solidMask[scaledPoint.y * _solidMaskPitch + scaledPoint.x / 32];
+	return (bits >> (scaledPoint.x % 32)) & 1;
 }
 
 int VisualImageXMG::getWidth() const {
@@ -25,6 +25,7 @@
 
 #include "engines/stark/visual/visual.h"
 
+#include "common/array.h"
 #include "common/rect.h"
 #include "common/stream.h"
 
@@ -51,9 +52,11 @@ public:
 	~VisualImageXMG() override;
 
 	/**
-	 * Load the pixel data from a XMG image
+	 * Use the pixel data from a decoded XMG image
+	 *
+	 * The visual takes ownership of the surface.
 	 */
-	void load(Common::ReadStream *stream);
+	void load(Graphics::Surface *surface);
 
 	/**
 	 * Load the size from an XMG image
@@ -94,10 +97,15 @@ public:
 private:
 	Graphics::Surface *multiplyColorWithAlpha(const Graphics::Surface *source);
 
+	/** Compute the opaque pixels bitmap used for hit testing */
+	void buildSolidMask();
+
 	Gfx::Driver *_gfx;
 	Gfx::SurfaceRenderer *_surfaceRenderer;
 	Gfx::Texture *_texture;
 	Graphics::Surface *_surface;
+	Common::Array<uint32> _solidMask;
+	uint _solidMaskPitch;
 	Common::Point _hotspot;
 	uint _originalWidth;
 	uint _originalHeight;
@@ -546,6 +546,23 @@ void tglTexImage2D(int target, int level, int components, int width, int height,
 	TinyGL::gl_add_op(p);
 }
 
+void tglTexSubImage2D(int target, int level, int xoffset, int yoffset, int width, int height, int format, int type, void *pixels) {
+	TinyGL::GLParam p[10];
+
+	p[0].op = TinyGL::OP_TexSubImage2D;
+	p[1].i = target;
+	p[2].i = level;
+	p[3].i = xoffset;
+	p[4].i = yoffset;
+	p[5].i = width;
+	p[6].i = height;
+	p[7].i = format;
+	p[8].i = type;
+	p[9].p = pixels;
+
+	TinyGL::gl_add_op(p);
+}
+
 void tglBindTexture(int target, int texture) {
 	TinyGL::GLParam p[3];
 
@@ -675,8 +692,14 @@ void tglDebug(int mode) {
 }
 
 void tglSetShadowMaskBuf(unsigned char *buf) {
+	TinyGL::GLContext *c = TinyGL::gl_get_context();
+	tglSetShadowMaskBuf(buf, 0, 0, c->fb->xsize, c->fb->ysize);
+}
+
+void tglSetShadowMaskBuf(unsigned char *buf, int x, int y, int width, int height) {
 	TinyGL::GLContext *c = TinyGL::gl_get_context();
 	c->fb->shadow_mask_buf = buf;
+	c->fb->shadow_mask_rect = Common::Rect(x, y, x + width, y + height);
 }
 
 void tglSetShadowColor(unsigned char r, unsigned char g, unsigned char b) {
@@ -690,3 +713,7 @@ void tglEnableDirtyRects(bool enable) {
 	TinyGL::GLContext *c = TinyGL::gl_get_context();
 	c->_enableDirtyRectangles = enable;
 }
+
+void tglDrawPanorama(const TGLuint *faceTextures, const TGLfloat *faceVertices) {
+	TinyGL::tglIssueDrawCall(new Graphics::PanoramaDrawCall(faceTextures, faceVertices));
+}
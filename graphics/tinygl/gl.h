@@ -801,6 +801,9 @@ void tglBindTexture(int target, int texture);
 void tglTexImage2D(int target, int level, int components,
 				   int width, int height, int border,
 				   int format, int type, void *pixels);
+void tglTexSubImage2D(int target, int level, int xoffset, int yoffset,
+				   int width, int height,
+				   int format, int type, void *pixels);
 void tglTexEnvi(int target, int pname, int param);
 void tglTexParameteri(int target, int pname, int param);
 void tglPixelStorei(int pname, int param);
@@ -830,6 +833,8 @@ void tglAlphaFunc(TGLenum func, float ref);
 void tglDepthFunc(TGLenum func);
 
 void tglSetShadowMaskBuf(unsigned char *buf);
+// The mask only covers the given screen rectangle, with a pitch of width bytes.
+void tglSetShadowMaskBuf(unsigned char *buf, int x, int y, int width, int height);
 void tglSetShadowColor(unsigned char r, unsigned char g, unsigned char b);
 
 // opengl 1.2 arrays
@@ -847,6 +852,12 @@ void tglPolygonOffset(TGLfloat factor, TGLfloat units);
 
 void tglEnableDirtyRects(bool enable);
 
+// Draw a cube panorama centered on the viewer, for example a skybox. Each screen pixel
+// of the viewport samples the face hit by its view ray, without clipping or depth testing.
+// faceTextures holds the texture of each of the six faces, faceVertices holds the four vertices
+// of each face, in triangle strip order, using the (s, t, x, y, z) layout.
+void tglDrawPanorama(const TGLuint *faceTextures, const TGLfloat *faceVertices);
+
 void tglDebug(int mode);
 
 namespace TinyGL {
@@ -39,17 +39,37 @@ static inline int interpolate(int v00, int v01, int v10, int xf, int yf) {
 	return v00 + (((v01 - v00) * xf + (v10 - v00) * yf) >> INTERP_NORM_BITS);
 }
 
+// Interpolate a destination pixel from the source pixel p00 and its right and bottom neighbours
+static inline void resizeSample(unsigned char *pix, const unsigned char *p00, int src_pitch,
+								bool hasRight, bool hasBelow, int xf, int yf) {
+	const unsigned char *p01 = hasRight ? p00 + 4 : p00;
+	const unsigned char *p10 = hasBelow ? p00 + src_pitch : p00;
+
+	if ((xf + yf) <= INTERP_NORM) {
+		for (int j = 0; j < 3; j++) {
+			pix[j] = interpolate(p00[j], p01[j], p10[j], xf, yf);
+		}
+	} else {
+		const unsigned char *p11 = hasRight ? p10 + 4 : p10;
+
+		xf = INTERP_NORM - xf;
+		yf = INTERP_NORM - yf;
+		for (int j = 0; j < 3; j++) {
+			pix[j] = interpolate(p11[j], p10[j], p01[j], xf, yf);
+		}
+	}
+	pix[3] = p00[3];
+}
+
 // TODO: more accurate resampling
 
 void gl_resizeImage(unsigned char *dest, int xsize_dest, int ysize_dest,
 					unsigned char *src, int xsize_src, int ysize_src) {
-	unsigned char *pix, *pix_src;
-	int point1_offset = 0, point2_offset = 0, point3_offset = 0;
+	unsigned char *pix;
 	float x1, y1, x1inc, y1inc;
 	int xi, yi, xf, yf;
 
 	pix = dest;
-	pix_src = src;
 
 	x1inc = (float)(xsize_src - 1) / (float)(xsize_dest - 1);
 	y1inc = (float)(ysize_src - 1) / (float)(ysize_dest - 1);
@@ -63,48 +83,9 @@ void gl_resizeImage(unsigned char *dest, int xsize_dest, int ysize_dest,
 			xf = (int)((x1 - floor(x1)) * INTERP_NORM);
 			yf = (int)((y1 - floor(y1)) * INTERP_NORM);
 
-			if ((xf + yf) <= INTERP_NORM) {
-				for (int j = 0; j < 3; j++) {
-					point1_offset = (yi * xsize_src + xi) * 4 + j;
-					if ((xi + 1) < xsize_src)
-						point2_offset = (yi * xsize_src + xi + 1) * 4 + j;
-					else
-						point2_offset = point1_offset;
-					if ((yi + 1) < ysize_src)
-						point3_offset = ((yi + 1) * xsize_src + xi) * 4 + j;
-					else
-						point3_offset = point1_offset;
-					pix[j] = interpolate(pix_src[point1_offset], pix_src[point2_offset], pix_src[point3_offset], xf, yf);
-				}
-				pix[3] = pix_src[(yi * xsize_src + xi) * 4 + 3];
-			} else {
-				xf = INTERP_NORM - xf;
-				yf = INTERP_NORM - yf;
-				for (int j = 0; j < 3; j++) {
-					pix[j] = interpolate(pix_src[point1_offset], pix_src[point2_offset], pix_src[point3_offset], xf, yf);
-					if ((xi + 1) < xsize_src) {
-						if ((yi + 1) < ysize_src)
-							point1_offset = ((yi + 1) * xsize_src + xi + 1) * 4 + j;
-						else
-							point1_offset = (yi * xsize_src + xi + 1) * 4 + j;
-					} else {
-						if ((yi + 1) < ysize_src)
-							point1_offset = ((yi + 1) * xsize_src + xi) * 4 + j;
-						else
-							point1_offset = (yi * xsize_src + xi) * 4 + j;
-					}
-					if ((yi + 1) < ysize_src)
-						point2_offset = ((yi + 1) * xsize_src + xi) * 4 + j;
-					else
-						point2_offset = (yi * xsize_src + xi) * 4 + j;
-					if ((xi + 1) < xsize_src)
-						point3_offset = (yi * xsize_src + xi + 1) * 4 + j;
-					else
-						point3_offset = (yi * xsize_src + xi) * 4 + j;
-					pix[j] = interpolate(pix_src[point1_offset], pix_src[point2_offset], pix_src[point3_offset], xf, yf);
-				}
-				pix[3] = pix_src[(yi * xsize_src + xi) * 4 + 3];
-			}
+			resizeSample(pix, src + (yi * xsize_src + xi) * 4, xsize_src * 4,
+					(xi + 1) < xsize_src, (yi + 1) < ysize_src, xf, yf);
+
 			pix += 4;
 			x1 += x1inc;
 		}
@@ -112,6 +93,43 @@ void gl_resizeImage(unsigned char *dest, int xsize_dest, int ysize_dest,
 	}
 }
 
+// Same as gl_resizeImage, but only for the destination pixels interpolated from source pixels
+// all within a rectangle of the source image. src only contains the pixels of that rectangle.
+void gl_resizeImageRect(unsigned char *dest, int xsize_dest, int ysize_dest,
+						unsigned char *src, int xsize_src, int ysize_src,
+						int rect_x, int rect_y, int rect_w, int rect_h) {
+	float x1, y1, x1inc, y1inc;
+	int xi, yi, xf, yf;
+
+	x1inc = (float)(xsize_src - 1) / (float)(xsize_dest - 1);
+	y1inc = (float)(ysize_src - 1) / (float)(ysize_dest - 1);
+
+	y1 = 0;
+	for (int y = 0; y < ysize_dest; y++, y1 += y1inc) {
+		yi = (int)y1;
+		bool hasBelow = (yi + 1) < ysize_src;
+		if (yi < rect_y || (hasBelow ? yi + 1 : yi) >= rect_y + rect_h)
+			continue;
+
+		yf = (int)((y1 - floor(y1)) * INTERP_NORM);
+
+		unsigned char *pix = dest + y * xsize_dest * 4;
+
+		x1 = 0;
+		for (int x = 0; x < xsize_dest; x++, pix += 4, x1 += x1inc) {
+			xi = (int)x1;
+			bool hasRight = (xi + 1) < xsize_src;
+			if (xi < rect_x || (hasRight ? xi + 1 : xi) >= rect_x + rect_w)
+				continue;
+
+			xf = (int)((x1 - floor(x1)) * INTERP_NORM);
+
+			resizeSample(pix, src + ((yi - rect_y) * rect_w + xi - rect_x) * 4, rect_w * 4,
+					hasRight, hasBelow, xf, yf);
+		}
+	}
+}
+
 #define FRAC_BITS 16
 
 // resizing with no interlating nor nearest pixel
@@ -67,6 +67,7 @@ ADD_OP(PopName, 0, "")
 ADD_OP(LoadName, 1, "%d")
 
 ADD_OP(TexImage2D, 9, "%d %d %d %d %d %d %d %d %d")
+ADD_OP(TexSubImage2D, 9, "%d %d %d %d %d %d %d %d %d")
 ADD_OP(BindTexture, 2, "%C %d")
 ADD_OP(TexEnv, 7, "%C %C %C %f %f %f %f")
 ADD_OP(TexParameter, 7, "%C %C %C %f %f %f %f")
@@ -34,7 +34,7 @@
 
 namespace TinyGL {
 
-static GLTexture *find_texture(GLContext *c, unsigned int h) {
+GLTexture *find_texture(GLContext *c, unsigned int h) {
 	GLTexture *t;
 
 	t = c->shared_state.texture_hash_table[h % TEXTURE_HASH_TABLE_SIZE];
@@ -112,38 +112,22 @@ void glopBindTexture(GLContext *c, GLParam *p) {
 	c->current_texture = t;
 }
 
-void glopTexImage2D(GLContext *c, GLParam *p) {
-	int target = p[1].i;
-	int level = p[2].i;
-	int components = p[3].i;
-	int width = p[4].i;
-	int height = p[5].i;
-	int border = p[6].i;
-	int format = p[7].i;
-	int type = p[8].i;
-	byte *pixels = (byte *)p[9].p;
-	GLImage *im;
-	byte *pixels1;
-	bool do_free_after_rgb2rgba = false;
-
-	Graphics::PixelFormat sourceFormat;
+static Graphics::PixelFormat getSourcePixelFormat(int format, const char *caller) {
 	switch (format) {
 		case TGL_RGBA:
-			sourceFormat = Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24);
-			break;
+			return Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24);
 		case TGL_RGB:
-			sourceFormat = Graphics::PixelFormat(3, 8, 8, 8, 0, 0, 8, 16, 0);
-			break;
+			return Graphics::PixelFormat(3, 8, 8, 8, 0, 0, 8, 16, 0);
 		case TGL_BGRA:
-			sourceFormat = Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24);
-			break;
+			return Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24);
 		case TGL_BGR:
-			sourceFormat = Graphics::PixelFormat(3, 8, 8, 8, 0, 16, 8, 0, 0);
-			break;
+			return Graphics::PixelFormat(3, 8, 8, 8, 0, 16, 8, 0, 0);
 		default:
-			error("tglTexImage2D: Pixel format not handled.");
+			error("%s: Pixel format not handled.", caller);
 	}
+}
 
+static Graphics::PixelFormat getTexturePixelFormat(int format) {
 	Graphics::PixelFormat pf;
 	switch (format) {
 		case TGL_RGBA:
@@ -165,6 +149,25 @@ void glopTexImage2D(GLContext *c, GLParam *p) {
 		default:
 			break;
 	}
+	return pf;
+}
+
+void glopTexImage2D(GLContext *c, GLParam *p) {
+	int target = p[1].i;
+	int level = p[2].i;
+	int components = p[3].i;
+	int width = p[4].i;
+	int height = p[5].i;
+	int border = p[6].i;
+	int format = p[7].i;
+	int type = p[8].i;
+	byte *pixels = (byte *)p[9].p;
+	GLImage *im;
+	byte *pixels1;
+	bool do_free_after_rgb2rgba = false;
+
+	Graphics::PixelFormat sourceFormat = getSourcePixelFormat(format, "tglTexImage2D");
+	Graphics::PixelFormat pf = getTexturePixelFormat(format);
 	int bytes = pf.bytesPerPixel;
 
 	// Simply unpack RGB into RGBA with 255 for Alpha.
@@ -191,6 +194,9 @@ void glopTexImage2D(GLContext *c, GLParam *p) {
 		error("tglTexImage2D: combination of parameters not handled");
 	}
 
+	int srcXSize = width;
+	int srcYSize = height;
+
 	pixels1 = new byte[c->_textureSize * c->_textureSize * bytes];
 	if (pixels != NULL) {
 		if (width != c->_textureSize || height != c->_textureSize) {
@@ -218,6 +224,8 @@ void glopTexImage2D(GLContext *c, GLParam *p) {
 	im = &c->current_texture->images[level];
 	im->xsize = width;
 	im->ysize = height;
+	im->srcXSize = srcXSize;
+	im->srcYSize = srcYSize;
 	if (im->pixmap)
 		im->pixmap.free();
 	im->pixmap = Graphics::PixelBuffer(pf, pixels1);
@@ -229,6 +237,65 @@ void glopTexImage2D(GLContext *c, GLParam *p) {
 	}
 }
 
+void glopTexSubImage2D(GLContext *c, GLParam *p) {
+	int target = p[1].i;
+	int level = p[2].i;
+	int xoffset = p[3].i;
+	int yoffset = p[4].i;
+	int width = p[5].i;
+	int height = p[6].i;
+	int format = p[7].i;
+	int type = p[8].i;
+	byte *pixels = (byte *)p[9].p;
+	GLImage *im = &c->current_texture->images[level];
+
+	// FIXME: TGL_UNSIGNED_INT_8_8_8_8_REV would need byte swapping on big endian systems
+	if (target != TGL_TEXTURE_2D || level != 0 || pixels == NULL || !im->pixmap || type != TGL_UNSIGNED_BYTE) {
+		error("tglTexSubImage2D: combination of parameters not handled");
+	}
+
+	Graphics::PixelFormat sourceFormat = getSourcePixelFormat(format, "tglTexSubImage2D");
+	Graphics::PixelFormat pf = getTexturePixelFormat(format);
+	if (pf != im->pixmap.getFormat()) {
+		error("tglTexSubImage2D: Pixel format does not match the texture");
+	}
+
+	if (xoffset < 0 || yoffset < 0 || width <= 0 || height <= 0 ||
+			xoffset + width > im->srcXSize || yoffset + height > im->srcYSize) {
+		error("tglTexSubImage2D: Rectangle out of the texture bounds");
+	}
+
+	// Only the pixels of the rectangle need to be converted
+	byte *rectPixels = pixels;
+	if (format == TGL_RGB || format == TGL_BGR) {
+		Graphics::PixelBuffer temp(pf, width * height, DisposeAfterUse::NO);
+		Graphics::PixelBuffer pixPtr(sourceFormat, pixels);
+
+		for (int i = 0; i < width * height; ++i) {
+			uint8 r, g, b;
+			pixPtr.getRGBAt(i, r, g, b);
+			temp.setPixelAt(i, 255, r, g, b);
+		}
+		rectPixels = temp.getRawBuffer();
+	}
+
+	byte *dest = im->pixmap.getRawBuffer();
+	if (im->srcXSize != c->_textureSize || im->srcYSize != c->_textureSize) {
+		gl_resizeImageRect(dest, c->_textureSize, c->_textureSize, rectPixels,
+				im->srcXSize, im->srcYSize, xoffset, yoffset, width, height);
+	} else {
+		for (int y = 0; y < height; y++) {
+			memcpy(dest + ((yoffset + y) * c->_textureSize + xoffset) * 4, rectPixels + y * width * 4, width * 4);
+		}
+	}
+
+	c->current_texture->versionNumber++;
+
+	if (rectPixels != pixels) {
+		delete[] rectPixels;
+	}
+}
+
 // TODO: not all tests are done
 void glopTexEnv(GLContext *, GLParam *p) {
 	int target = p[1].i;
@@ -59,15 +59,85 @@ public:
 			}
 		}
 
+		buildLines();
+
+		_version++;
+	}
+
+	void updateData(const Graphics::Surface &surface, const Common::Rect &rect, uint32 colorKey, bool applyColorKey) {
+		if (surface.w != _surface.w || surface.h != _surface.h) {
+			loadData(surface, colorKey, applyColorKey);
+			return;
+		}
+
+		Common::Rect area = rect;
+		area.clip(Common::Rect(_surface.w, _surface.h));
+		if (area.isEmpty())
+			return;
+
+		// Convert the pixels of the area, checking if the transparent pixels are still the same
+		bool linesChanged = false;
+		for (int y = area.top; y < area.bottom; y++) {
+			Graphics::PixelBuffer buffer(surface.format, (byte *)const_cast<void *>(surface.getBasePtr(area.left, y)));
+			Graphics::PixelBuffer dataBuffer(_surface.format, (byte *)_surface.getBasePtr(area.left, y));
+
+			for (int x = 0; x < area.width(); x++) {
+				uint8 oldA, a, r, g, b;
+				dataBuffer.getARGBAt(x, oldA, r, g, b);
+
+				if (applyColorKey && buffer.getValueAt(x) == colorKey) {
+					// Color keyed pixels become transparent white.
+					a = 0;
+					r = g = b = 255;
+				} else {
+					buffer.getARGBAt(x, a, r, g, b);
+				}
+				dataBuffer.setPixelAt(x, a, r, g, b);
+
+				if ((a == 0) != (oldA == 0)) {
+					linesChanged = true;
+				}
+				if (a != 0 && a != 0xFF) {
+					_binaryTransparent = false;
+				}
+			}
+		}
+
+		if (linesChanged) {
+			buildLines();
+		} else {
+			// Only refresh the pixels of the existing lines
+			for (uint i = 0; i < _lines.size(); i++) {
+				Line &l = _lines[i];
+				if (l._y < area.top || l._y >= area.bottom)
+					continue;
+
+				int start = MAX<int>(l._x, area.left);
+				int end = MIN<int>(l._x + l._length, area.right);
+				if (start >= end)
+					continue;
+
+				Graphics::PixelBuffer srcBuf(_surface.format, (byte *)_surface.getBasePtr(0, l._y));
+				l._buf.copyBuffer(start - l._x, start, end - start, srcBuf);
+			}
+		}
+
+		_version++;
+	}
+
+	void buildLines() {
+		const Graphics::PixelFormat &textureFormat = _surface.format;
+		Graphics::PixelBuffer dataBuffer(textureFormat, (byte *)_surface.getPixels());
+
 		// Create opaque lines data.
 		// A line of pixels can not wrap more that one line of the image, since it would break
 		// blitting of bitmaps with a non-zero x position.
 		Graphics::PixelBuffer srcBuf = dataBuffer;
 		_lines.clear();
 		_binaryTransparent = true;
-		for (int y = 0; y < surface.h; y++) {
+		for (int y = 0; y < _surface.h; y++) {
 			int start = -1;
-			for (int x = 0; x < surface.w; ++x) {
+			for (int x = 0; x < _surface.w; ++x) {
 				// We found a transparent pixel, so save a line from 'start' to the pixel before this.
 				uint8 r, g, b, a;
 				srcBuf.getARGBAt(x, a, r, g, b);
@@ -83,12 +153,10 @@ public:
 			}
 			// end of the bitmap line. if start is an actual pixel save the line.
 			if (start >= 0) {
-				_lines.push_back(Line(start, y, surface.w - start, srcBuf.getRawBuffer(start), textureFormat));
+				_lines.push_back(Line(start, y, _surface.w - start, srcBuf.getRawBuffer(start), textureFormat));
 			}
-			srcBuf.shiftBy(surface.w);
+			srcBuf.shiftBy(_surface.w);
 		}
-
-		_version++;
 	}
 
 	int getVersion() const {
@@ -284,6 +352,12 @@ void tglUploadBlitImage(BlitImage *blitImage, const Graphics::Surface& surface,
 	}
 }
 
+void tglUpdateBlitImage(BlitImage *blitImage, const Graphics::Surface &surface, const Common::Rect &rect, uint32 colorKey, bool applyColorKey) {
+	if (blitImage != nullptr) {
+		blitImage->updateData(surface, rect, colorKey, applyColorKey);
+	}
+}
+
 void tglDeleteBlitImage(BlitImage *blitImage) {
 	if (blitImage != nullptr) {
 		blitImage->dispose();
@@ -103,6 +103,17 @@ BlitImage *tglGenBlitImage();
 */
 void tglUploadBlitImage(BlitImage *blitImage, const Graphics::Surface &surface, uint32 colorKey, bool applyColorKey);
 
+/**
+@brief Copies a rectangle of a surface data into the provided blit image.
+The surface must have the same size as the one previously uploaded.
+@param pointer to the blit image.
+@param referece to the surface that's being copied
+@param rectangle of the surface to copy
+@param color key value for alpha color keying
+@param boolean that enables alpha color keying
+*/
+void tglUpdateBlitImage(BlitImage *blitImage, const Graphics::Surface &surface, const Common::Rect &rect, uint32 colorKey, bool applyColorKey);
+
 /**
 @brief Destroys an instance of blit image.
 @param pointer to the blit image.
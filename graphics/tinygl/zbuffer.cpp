@@ -105,6 +105,7 @@ FrameBuffer::FrameBuffer(int width, int height, const Graphics::PixelBuffer &fra
 
 	this->current_texture = NULL;
 	this->shadow_mask_buf = NULL;
+	this->shadow_mask_rect = Common::Rect(xsize, ysize);
 
 	this->buffer.pbuf = this->pbuf.getRawBuffer();
 	this->buffer.zbuf = this->_zbuf;
@@ -70,7 +70,6 @@ namespace TinyGL {
 static const int DRAW_DEPTH_ONLY = 0;
 static const int DRAW_FLAT = 1;
 static const int DRAW_SMOOTH = 2;
-static const int DRAW_SHADOW_MASK = 3;
 static const int DRAW_SHADOW = 4;
 
 struct Buffer {
@@ -474,6 +473,7 @@ struct FrameBuffer {
 	Buffer buffer;
 
 	unsigned char *shadow_mask_buf;
+	Common::Rect shadow_mask_rect; // screen area covered by shadow_mask_buf
 	int shadow_color_r;
 	int shadow_color_g;
 	int shadow_color_b;
@@ -279,6 +279,9 @@ bool DrawCall::operator==(const DrawCall &other) const {
 		case DrawCall_Clear:
 			return *(const ClearBufferDrawCall *)this == (const ClearBufferDrawCall &)other;
 			break;
+		case DrawCall_Panorama:
+			return *(const PanoramaDrawCall *)this == (const PanoramaDrawCall &)other;
+			break;
 		default:
 			return false;
 		}
@@ -454,6 +457,7 @@ RasterizationDrawCall::RasterizationState RasterizationDrawCall::captureState()
 	state.texture2DEnabled = c->texture_2d_enabled;
 	state.texture = c->current_texture;
 	state.shadowMaskBuf = c->fb->shadow_mask_buf;
+	state.shadowMaskRect = c->fb->shadow_mask_rect;
 	state.depthFunction = c->fb->getDepthFunc();
 	state.depthWrite = c->fb->getDepthWrite();
 	state.lightingEnabled = c->lighting_enabled;
@@ -490,6 +494,7 @@ void RasterizationDrawCall::applyState(const RasterizationDrawCall::Rasterizatio
 	c->texture_2d_enabled = state.texture2DEnabled;
 	c->current_texture = state.texture; 
 	c->fb->shadow_mask_buf = state.shadowMaskBuf;
+	c->fb->shadow_mask_rect = state.shadowMaskRect;
 
 	memcpy(c->viewport.scale._v, state.viewportScaling, sizeof(c->viewport.scale._v));
 	memcpy(c->viewport.trans._v, state.viewportTranslation, sizeof(c->viewport.trans._v));
@@ -651,6 +656,199 @@ bool ClearBufferDrawCall::operator==(const ClearBufferDrawCall &other) const {
 			_zValue == other._zValue;
 }
 
+PanoramaDrawCall::PanoramaDrawCall(const unsigned int *faceTextures, const float *faceVertices) : DrawCall(DrawCall_Panorama) {
+	TinyGL::GLContext *c = TinyGL::gl_get_context();
+
+	for (int axis = 0; axis < 3; axis++) {
+		_faceForAxis[axis][0] = -1;
+		_faceForAxis[axis][1] = -1;
+	}
+
+	for (int i = 0; i < 6; i++) {
+		Face &face = _faces[i];
+		const float *v = faceVertices + 20 * i;
+
+		face.texture = TinyGL::find_texture(c, faceTextures[i]);
+		face.textureVersion = face.texture ? face.texture->versionNumber : 0;
+
+		// The face axis is the dominant axis of the face center
+		float center[3];
+		for (int j = 0; j < 3; j++) {
+			center[j] = (v[2 + j] + v[7 + j] + v[12 + j] + v[17 + j]) / 4.0f;
+		}
+
+		int axis = 0;
+		for (int j = 1; j < 3; j++) {
+			if (fabs(center[j]) > fabs(center[axis]))
+				axis = j;
+		}
+		_faceForAxis[axis][center[axis] >= 0.0f] = i;
+		float distance = fabs(center[axis]);
+
+		// Find the texture coordinate gradients in the face plane, using its first triangle
+		float e1[3], e2[3];
+		for (int j = 0; j < 3; j++) {
+			e1[j] = v[7 + j] - v[2 + j];
+			e2[j] = v[12 + j] - v[2 + j];
+		}
+
+		float e1e1 = e1[0] * e1[0] + e1[1] * e1[1] + e1[2] * e1[2];
+		float e1e2 = e1[0] * e2[0] + e1[1] * e2[1] + e1[2] * e2[2];
+		float e2e2 = e2[0] * e2[0] + e2[1] * e2[1] + e2[2] * e2[2];
+		float det = e1e1 * e2e2 - e1e2 * e1e2;
+
+		float ds1 = v[5] - v[0], ds2 = v[10] - v[0];
+		float dt1 = v[6] - v[1], dt2 = v[11] - v[1];
+		float sAlpha = (ds1 * e2e2 - ds2 * e1e2) / det, sBeta = (ds2 * e1e1 - ds1 * e1e2) / det;
+		float tAlpha = (dt1 * e2e2 - dt2 * e1e2) / det, tBeta = (dt2 * e1e1 - dt1 * e1e2) / det;
+
+		face.sOffset = v[0];
+		face.tOffset = v[1];
+		for (int j = 0; j < 3; j++) {
+			float sGradient = sAlpha * e1[j] + sBeta * e2[j];
+			float tGradient = tAlpha * e1[j] + tBeta * e2[j];
+
+			face.sOffset -= sGradient * v[2 + j];
+			face.tOffset -= tGradient * v[2 + j];
+
+			// The ray hits the face plane at ray * distance / ray[axis]
+			face.sGradient[j] = sGradient * distance;
+			face.tGradient[j] = tGradient * distance;
+		}
+	}
+
+	if (c->viewport.updated) {
+		TinyGL::gl_eval_viewport(c);
+		c->viewport.updated = 0;
+	}
+
+	// Unprojecting a point of the view frustum gives a vector along the view ray.
+	// It is an affine function of the screen coordinates, so it can be stepped incrementally.
+	TinyGL::Matrix4 unproject = ((*c->matrix_stack_ptr[1]) * (*c->matrix_stack_ptr[0])).inverse();
+	const TinyGL::GLViewport &vp = c->viewport;
+	for (int j = 0; j < 3; j++) {
+		_rayDx[j] = unproject._m[j][0] / vp.scale.X;
+		_rayDy[j] = unproject._m[j][1] / vp.scale.Y;
+		_ray[j] = unproject._m[j][3] + (0.5f - vp.trans.X) * _rayDx[j] + (0.5f - vp.trans.Y) * _rayDy[j];
+	}
+
+	_viewport = Common::Rect(vp.xmin, vp.ymin, vp.xmin + vp.xsize, vp.ymin + vp.ysize);
+	_viewport.clip(Common::Rect(c->fb->xsize, c->fb->ysize));
+
+	if (c->_enableDirtyRectangles) {
+		_dirtyRegion = _viewport;
+	}
+}
+
+void PanoramaDrawCall::execute(bool restoreState) const {
+	draw(_viewport);
+}
+
+void PanoramaDrawCall::execute(const Common::Rect &clippingRectangle, bool restoreState) const {
+	draw(clippingRectangle.findIntersectingRect(_viewport));
+}
+
+void PanoramaDrawCall::draw(const Common::Rect &rect) const {
+	TinyGL::GLContext *c = TinyGL::gl_get_context();
+	TinyGL::FrameBuffer *fb = c->fb;
+
+	if (rect.isEmpty())
+		return;
+
+	const int textureSize = fb->_textureSize;
+	const float textureScale = textureSize;
+
+	const uint32 *texels[6];
+	Graphics::PixelFormat textureFormats[6];
+	bool sameFormat[6];
+	for (int i = 0; i < 6; i++) {
+		const TinyGL::GLTexture *texture = _faces[i].texture;
+		if (texture && texture->images[0].pixmap) {
+			texels[i] = (const uint32 *)texture->images[0].pixmap.getRawBuffer();
+			textureFormats[i] = texture->images[0].pixmap.getFormat();
+			sameFormat[i] = textureFormats[i] == fb->cmode;
+		} else {
+			texels[i] = nullptr;
+		}
+	}
+
+	uint32 *colorBuffer = (uint32 *)fb->getPixelBuffer();
+
+	for (int y = rect.top; y < rect.bottom; y++) {
+		float ray[3];
+		for (int j = 0; j < 3; j++) {
+			ray[j] = _ray[j] + rect.left * _rayDx[j] + y * _rayDy[j];
+		}
+
+		int pixel = y * fb->xsize + rect.left;
+		for (int x = rect.left; x < rect.right; x++, pixel++) {
+			float absX = fabs(ray[0]), absY = fabs(ray[1]), absZ = fabs(ray[2]);
+
+			int axis;
+			float length;
+			if (absX >= absY && absX >= absZ) {
+				axis = 0;
+				length = absX;
+			} else if (absY >= absZ) {
+				axis = 1;
+				length = absY;
+			} else {
+				axis = 2;
+				length = absZ;
+			}
+
+			int faceIndex = _faceForAxis[axis][ray[axis] >= 0.0f];
+			if (faceIndex >= 0 && texels[faceIndex]) {
+				const Face &face = _faces[faceIndex];
+				float inv = 1.0f / length;
+
+				float s = face.sOffset + (face.sGradient[0] * ray[0] + face.sGradient[1] * ray[1] + face.sGradient[2] * ray[2]) * inv;
+				float t = face.tOffset + (face.tGradient[0] * ray[0] + face.tGradient[1] * ray[1] + face.tGradient[2] * ray[2]) * inv;
+
+				int sss = CLIP<int>((int)(s * textureScale), 0, textureSize - 1);
+				int ttt = CLIP<int>((int)(t * textureScale), 0, textureSize - 1);
+				uint32 col = texels[faceIndex][ttt * textureSize + sss];
+
+				if (sameFormat[faceIndex]) {
+					colorBuffer[pixel] = col;
+				} else {
+					const Graphics::PixelFormat &textureFormat = textureFormats[faceIndex];
+					fb->writePixel<false, false, false>(pixel,
+							(col >> textureFormat.aShift) & 0xFF,
+							(col >> textureFormat.rShift) & 0xFF,
+							(col >> textureFormat.gShift) & 0xFF,
+							(col >> textureFormat.bShift) & 0xFF, 0);
+				}
+			}
+
+			ray[0] += _rayDx[0];
+			ray[1] += _rayDx[1];
+			ray[2] += _rayDx[2];
+		}
+	}
+}
+
+bool PanoramaDrawCall::Face::operator==(const Face &other) const {
+	return	texture == other.texture &&
+			textureVersion == other.textureVersion &&
+			sOffset == other.sOffset &&
+			tOffset == other.tOffset &&
+			memcmp(sGradient, other.sGradient, sizeof(sGradient)) == 0 &&
+			memcmp(tGradient, other.tGradient, sizeof(tGradient)) == 0;
+}
+
+bool PanoramaDrawCall::operator==(const PanoramaDrawCall &other) const {
+	for (int i = 0; i < 6; i++) {
+		if (!(_faces[i] == other._faces[i]))
+			return false;
+	}
+
+	return	_viewport == other._viewport &&
+			memcmp(_ray, other._ray, sizeof(_ray)) == 0 &&
+			memcmp(_rayDx, other._rayDx, sizeof(_rayDx)) == 0 &&
+			memcmp(_rayDy, other._rayDy, sizeof(_rayDy)) == 0;
+}
+
 
 bool RasterizationDrawCall::RasterizationState::operator==(const RasterizationState &other) const {
 	return	beginType == other.beginType && 
@@ -674,6 +872,7 @@ bool RasterizationDrawCall::RasterizationState::operator==(const RasterizationSt
 			alphaRefValue == other.alphaRefValue &&
 			texture == other.texture &&
 			shadowMaskBuf == other.shadowMaskBuf &&
+			shadowMaskRect == other.shadowMaskRect &&
 			viewportTranslation[0] == other.viewportTranslation[0] &&
 			viewportTranslation[1] == other.viewportTranslation[1] &&
 			viewportTranslation[2] == other.viewportTranslation[2] &&
@@ -51,7 +51,8 @@ public:
 	enum DrawCallType {
 		DrawCall_Rasterization,
 		DrawCall_Blitting,
-		DrawCall_Clear
+		DrawCall_Clear,
+		DrawCall_Panorama
 	};
 
 	DrawCall(DrawCallType type) : _type(type) { }
@@ -133,6 +134,7 @@ private:
 		int alphaFunc, alphaRefValue;
 		TinyGL::GLTexture *texture;
 		unsigned char *shadowMaskBuf;
+		Common::Rect shadowMaskRect;
 
 		bool operator==(const RasterizationState &other) const;
 	};
@@ -197,6 +199,41 @@ private:
 	BlittingState _blitState;
 };
 
+// Encapsulate a cube panorama draw call: each pixel samples the face hit by its view ray.
+class PanoramaDrawCall : public DrawCall {
+public:
+	PanoramaDrawCall(const unsigned int *faceTextures, const float *faceVertices);
+	virtual ~PanoramaDrawCall() { }
+	bool operator==(const PanoramaDrawCall &other) const;
+	virtual void execute(bool restoreState) const;
+	virtual void execute(const Common::Rect &clippingRectangle, bool restoreState) const;
+
+	void *operator new(size_t size) {
+		return ::Internal::allocateFrame(size);
+	}
+
+	void operator delete(void *p) { }
+private:
+	void draw(const Common::Rect &rect) const;
+
+	// The texture coordinates of a face are affine functions of the view ray
+	// divided by its component along the face axis
+	struct Face {
+		TinyGL::GLTexture *texture;
+		int textureVersion;
+		float sGradient[3], tGradient[3];
+		float sOffset, tOffset;
+
+		bool operator==(const Face &other) const;
+	};
+
+	Face _faces[6];
+	int _faceForAxis[3][2]; // Face index for each axis and direction, -1 if none
+	float _ray[3];          // View ray for the pixel (0, 0)
+	float _rayDx[3], _rayDy[3];
+	Common::Rect _viewport;
+};
+
 } // end of namespace Graphics
 
 #endif
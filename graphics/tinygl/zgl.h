@@ -175,6 +175,7 @@ struct GLVertex {
 struct GLImage {
 	Graphics::PixelBuffer pixmap;
 	int xsize, ysize;
+	int srcXSize, srcYSize; // Size of the image as specified by glTexImage2D, before resizing
 };
 
 // textures
@@ -407,6 +408,9 @@ void gl_draw_triangle_line(GLContext *c, GLVertex *p0, GLVertex *p1, GLVertex *p
 void gl_draw_triangle_fill(GLContext *c, GLVertex *p0, GLVertex *p1, GLVertex *p2);
 void gl_draw_triangle_select(GLContext *c, GLVertex *p0, GLVertex *p1, GLVertex *p2);
 
+// vertex.c
+void gl_eval_viewport(GLContext *c);
+
 // matrix.c
 void gl_print_matrix(const float *m);
 
@@ -418,12 +422,16 @@ void gl_shade_vertex(GLContext *c, GLVertex *v);
 void glInitTextures(GLContext *c);
 void glEndTextures(GLContext *c);
 GLTexture *alloc_texture(GLContext *c, int h);
+GLTexture *find_texture(GLContext *c, unsigned int h);
 void free_texture(GLContext *c, int h);
 void free_texture(GLContext *c, GLTexture *t);
 
 // image_util.c
 void gl_resizeImage(unsigned char *dest, int xsize_dest, int ysize_dest,
 					unsigned char *src, int xsize_src, int ysize_src);
+void gl_resizeImageRect(unsigned char *dest, int xsize_dest, int ysize_dest,
+						unsigned char *src, int xsize_src, int ysize_src,
+						int rect_x, int rect_y, int rect_w, int rect_h);
 void gl_resizeImageNoInterpolate(unsigned char *dest, int xsize_dest, int ysize_dest,
 								 unsigned char *src, int xsize_src, int ysize_src);
 
@@ -27,6 +27,7 @@
  */
 
 #include "common/endian.h"
+#include "common/util.h"
 #include "graphics/tinygl/zbuffer.h"
 #include "graphics/tinygl/zgl.h"
 
@@ -123,7 +124,6 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 	ZBufferPoint *tp, *pr1 = 0, *pr2 = 0, *l1 = 0, *l2 = 0;
 	float fdx1, fdx2, fdy1, fdy2, fz0, d1, d2;
 	unsigned int *pz1 = NULL;
-	unsigned char *pm1 = NULL;
 	int part, update_left = 1, update_right = 1;
 
 	int nb_lines, dx1, dy1, tmp, dx2, dy2, y;
@@ -245,11 +245,7 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 	pz1 = _zbuf + p0->y * xsize;
 
 	switch (kDrawLogic) {
-	case DRAW_SHADOW_MASK:
-		pm1 = shadow_mask_buf + p0->y * xsize;
-		break;
 	case DRAW_SHADOW:
-		pm1 = shadow_mask_buf + p0->y * xsize;
 		r1 = shadow_color_r;
 		g1 = shadow_color_g;
 		b1 = shadow_color_b;
@@ -427,61 +423,51 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 						n -= 1;
 						x += 1;
 					}
-				} else if (kDrawLogic == DRAW_SHADOW_MASK) {
-					unsigned char *pm;
-					int n;
-
-					n = (x2 >> 16) - x1;
-					pm = pm1 + x1;
-					while (n >= 3) {
-						pm[0] = 0xff;
-						pm[1] = 0xff;
-						pm[2] = 0xff;
-						pm[3] = 0xff;
-						pm += 4;
-						n -= 4;
-						x += 4;
-					}
-					while (n >= 0) {
-						pm[0] = 0xff;
-						pm += 1;
-						n -= 1;
-						x += 1;
-					}
 				} else if (kDrawLogic == DRAW_SHADOW) {
-					unsigned char *pm;
-					int n;
-					unsigned int *pz;
-					unsigned int z;
-					unsigned int r = r1;
-					unsigned int g = g1;
-					unsigned int b = b1;
-
-					n = (x2 >> 16) - x1;
-
-					int buf = pp1 + x1;
-
-					pm = pm1 + x1;
-					pz = pz1 + x1;
-					z = z1;
-					while (n >= 3) {
-						putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 0, x, y, z, r, g, b, dzdx, pm);
-						putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 1, x, y, z, r, g, b, dzdx, pm);
-						putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 2, x, y, z, r, g, b, dzdx, pm);
-						putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 3, x, y, z, r, g, b, dzdx, pm);
-						pz += 4;
-						pm += 4;
-						buf += 4;
-						n -= 4;
-						x += 4;
-					}
-					while (n >= 0) {
-						putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 0, x, y, z, r, g, b, dzdx, pm);
-						pz += 1;
-						pm += 1;
-						buf += 1;
-						n -= 1;
-						x += 1;
+					// The mask is empty outside of its rectangle, so clip the span against it first.
+					int xStart = MAX<int>(x1, shadow_mask_rect.left);
+					int xEnd = MIN<int>(x2 >> 16, shadow_mask_rect.right - 1);
+					if (y >= shadow_mask_rect.top && y < shadow_mask_rect.bottom && xStart <= xEnd) {
+						unsigned char *pm;
+						int n;
+						unsigned int *pz;
+						unsigned int z;
+						unsigned int r = r1;
+						unsigned int g = g1;
+						unsigned int b = b1;
+
+						n = xEnd - xStart;
+						x = xStart;
+
+						int buf = pp1 + xStart;
+
+						pm = shadow_mask_buf + (y - shadow_mask_rect.top) * shadow_mask_rect.width() + (xStart - shadow_mask_rect.left);
+						pz = pz1 + xStart;
+						z = z1 + (xStart - x1) * dzdx;
+						while (n >= 3) {
+							// Test four mask bytes at once and skip the whole group when none is set.
+							if (READ_UINT32(pm)) {
+								putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 0, x, y, z, r, g, b, dzdx, pm);
+								putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 1, x, y, z, r, g, b, dzdx, pm);
+								putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 2, x, y, z, r, g, b, dzdx, pm);
+								putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 3, x, y, z, r, g, b, dzdx, pm);
+							} else {
+								z += 4 * dzdx;
+							}
+							pz += 4;
+							pm += 4;
+							buf += 4;
+							n -= 4;
+							x += 4;
+						}
+						while (n >= 0) {
+							putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 0, x, y, z, r, g, b, dzdx, pm);
+							pz += 1;
+							pm += 1;
+							buf += 1;
+							n -= 1;
+							x += 1;
+						}
 					}
 				} else if (kDrawLogic == DRAW_SMOOTH && !(kInterpST || kInterpSTZ)) {
 					unsigned int *pz;
@@ -622,8 +608,6 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 			pp1 += xsize;
 			pz1 += xsize;
 
-			if (kDrawLogic == DRAW_SHADOW || kDrawLogic == DRAW_SHADOW_MASK)
-				pm1 = pm1 + xsize;
 			nb_lines--;
 			y++;
 		}
@@ -722,15 +706,119 @@ void FrameBuffer::fillTriangleTextureMappingPerspectiveFlat(ZBufferPoint *p0, ZB
 		fillTriangle<interpRGB, interpZ, interpST, interpSTZ, DRAW_FLAT, false>(p0, p1, p2);
 }
 
+// Shadow masks only record coverage, so they get their own rasterizer: no depth,
+// colour or texture interpolation, and spans are clipped to the mask rectangle and
+// filled with memset. Edge walking is the same as in fillTriangle() above so the
+// covered pixels match the ones the shadow pass will test.
 void FrameBuffer::fillTriangleFlatShadowMask(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint *p2) {
-	const bool interpZ = true;
-	const bool interpRGB = false;
-	const bool interpST = false;
-	const bool interpSTZ = false;
-	if (_depthWrite && _depthTestEnabled)
-		fillTriangle<interpRGB, interpZ, interpST, interpSTZ, DRAW_SHADOW_MASK, true>(p0, p1, p2);
-	else
-		fillTriangle<interpRGB, interpZ, interpST, interpSTZ, DRAW_SHADOW_MASK, false>(p0, p1, p2);
+	ZBufferPoint *tp, *pr1, *pr2, *l1, *l2;
+	int part, update_left = 1, update_right = 1;
+	int nb_lines, dx1, dy1, tmp, dx2, dy2, y;
+	int error = 0, derror = 0;
+	int x1 = 0, dxdy_min = 0, dxdy_max = 0;
+	// warning: x2 is multiplied by 2^16
+	int x2 = 0, dx2dy2 = 0;
+
+	// we sort the vertex with increasing y
+	if (p1->y < p0->y) {
+		tp = p0;
+		p0 = p1;
+		p1 = tp;
+	}
+	if (p2->y < p0->y) {
+		tp = p2;
+		p2 = p1;
+		p1 = p0;
+		p0 = tp;
+	} else if (p2->y < p1->y) {
+		tp = p1;
+		p1 = p2;
+		p2 = tp;
+	}
+
+	const Common::Rect &maskRect = shadow_mask_rect;
+	if (p2->y < maskRect.top || p0->y >= maskRect.bottom)
+		return;
+
+	int fz0 = (p1->x - p0->x) * (p2->y - p0->y) - (p2->x - p0->x) * (p1->y - p0->y);
+	if (fz0 == 0)
+		return;
+
+	if (fz0 > 0) {
+		l1 = p0;
+		l2 = p2;
+		pr1 = p0;
+		pr2 = p1;
+	} else {
+		l1 = p0;
+		l2 = p1;
+		pr1 = p0;
+		pr2 = p2;
+	}
+	nb_lines = p1->y - p0->y;
+	y = p0->y;
+	for (part = 0; part < 2; part++) {
+		if (part == 1) {
+			// second part
+			if (fz0 > 0) {
+				update_left = 0;
+				pr1 = p1;
+				pr2 = p2;
+			} else {
+				update_right = 0;
+				l1 = p1;
+				l2 = p2;
+			}
+			nb_lines = p2->y - p1->y + 1;
+		}
+
+		if (update_left) {
+			dy1 = l2->y - l1->y;
+			dx1 = l2->x - l1->x;
+			if (dy1 > 0)
+				tmp = (dx1 << 16) / dy1;
+			else
+				tmp = 0;
+			x1 = l1->x;
+			error = 0;
+			derror = tmp & 0x0000ffff;
+			dxdy_min = tmp >> 16;
+			dxdy_max = dxdy_min + 1;
+		}
+
+		if (update_right) {
+			dx2 = (pr2->x - pr1->x);
+			dy2 = (pr2->y - pr1->y);
+			if (dy2 > 0)
+				dx2dy2 = (dx2 << 16) / dy2;
+			else
+				dx2dy2 = 0;
+			x2 = pr1->x << 16;
+		}
+
+		while (nb_lines > 0) {
+			if (y >= maskRect.top && y < maskRect.bottom) {
+				int xStart = MAX<int>(x1, maskRect.left);
+				int xEnd = MIN<int>(x2 >> 16, maskRect.right - 1);
+				if (xStart <= xEnd) {
+					unsigned char *pm = shadow_mask_buf + (y - maskRect.top) * maskRect.width() + (xStart - maskRect.left);
+					memset(pm, 0xff, xEnd - xStart + 1);
+				}
+			}
+
+			error += derror;
+			if (error > 0) {
+				error -= 0x10000;
+				x1 += dxdy_max;
+			} else {
+				x1 += dxdy_min;
+			}
+			x2 += dx2dy2;
+
+			nb_lines--;
+			y++;
+		}
+	}
 }
 
 void FrameBuffer::fillTriangleFlatShadow(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint *p2) {
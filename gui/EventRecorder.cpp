@@ -208,6 +208,12 @@ bool EventRecorder::pollEvent(Common::Event &ev) {
 	return true;
 }
 
+void EventRecorder::setFastPlayback(bool fastPlayback) {
+	if (_recordMode == kRecorderPlayback || _recordMode == kRecorderPlaybackPause) {
+		_fastPlayback = fastPlayback;
+	}
+}
+
 void EventRecorder::switchFastMode() {
 	if (_recordMode == kRecorderPlaybackPause) {
 		_fastPlayback = !_fastPlayback;
@@ -270,6 +276,7 @@ void EventRecorder::init(Common::String recordFileName, RecordMode mode) {
 	_playbackFile = new Common::PlaybackFile();
 	_lastScreenshotTime = 0;
 	_recordMode = mode;
+	_fastPlayback = false;
 	_needcontinueGame = false;
 	if (ConfMan.hasKey("disable_display")) {
 		DebugMan.enableDebugChannel("EventRec");
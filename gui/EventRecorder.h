@@ -87,6 +87,12 @@ public:
 	void processGameDescription(const ADGameDescription *desc);
 	Common::SeekableReadStream *processSaveStream(const Common::String & fileName);
 
+	/** Replay the recording as fast as possible, skipping the delays
+	 *
+	 *  Only has an effect when playing back a recording
+	 */
+	void setFastPlayback(bool fastPlayback);
+
 	/** Hooks for intercepting into GUI processing, so required events could be shoot
 	 *  or filtered out */
 	void preDrawOverlayGui();